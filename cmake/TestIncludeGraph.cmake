@@ -0,0 +1,74 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+cmake_minimum_required(VERSION 3.19)
+
+#
+# add_include_graph_test(<name>
+#                        TARGET <target>
+#                        HEADER <header>
+#                        FORBIDDEN <regex>...)
+#
+# Registers a test that preprocesses `#include <header>` with the usage requirements of
+# <target> and fails if any of the transitively included files matches one of the FORBIDDEN
+# regular expressions. It guards fine-grained headers against silently growing their include cost.
+#
+# Only GCC and Clang are supported as the test relies on the `-M` dependency output.
+#
+function(add_include_graph_test name)
+    # parse arguments
+    set(oneValueArgs TARGET HEADER)
+    set(multiValues FORBIDDEN)
+    cmake_parse_arguments(PARSE_ARGV 1 ARG "" "${oneValueArgs}" "${multiValues}")
+
+    # validate and process arguments
+    if(ARG_UNPARSED_ARGUMENTS)
+        message(FATAL_ERROR "Invalid arguments '${ARG_UNPARSED_ARGUMENTS}' for include graph test '${name}'")
+    endif()
+    foreach(arg TARGET HEADER FORBIDDEN)
+        if(NOT ARG_${arg})
+            message(FATAL_ERROR "'${arg}' not provided for include graph test '${name}'")
+        endif()
+    endforeach()
+
+    if(NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+        message(STATUS "Include graph test '${name}' is not supported for ${CMAKE_CXX_COMPILER_ID}")
+        return()
+    endif()
+
+    set(source "${CMAKE_CURRENT_BINARY_DIR}/include_graph/${name}.cpp")
+    file(WRITE "${source}" "#include <${ARG_HEADER}>\n")
+
+    separate_arguments(flags NATIVE_COMMAND "${CMAKE_CXX_FLAGS}")
+    set(include_dirs "$<TARGET_PROPERTY:${ARG_TARGET},INTERFACE_INCLUDE_DIRECTORIES>")
+    set(definitions "$<TARGET_PROPERTY:${ARG_TARGET},INTERFACE_COMPILE_DEFINITIONS>")
+    add_test(
+        NAME ${name}
+        COMMAND
+            ${CMAKE_CXX_COMPILER} ${flags} -std=c++20 -M "$<$<BOOL:${include_dirs}>:-I$<JOIN:${include_dirs},;-I>>"
+            "$<$<BOOL:${definitions}>:-D$<JOIN:${definitions},;-D>>" "${source}"
+        COMMAND_EXPAND_LISTS
+    )
+
+    list(JOIN ARG_FORBIDDEN "|" forbidden)
+    set_tests_properties(${name} PROPERTIES FAIL_REGULAR_EXPRESSION "${forbidden}")
+endfunction()
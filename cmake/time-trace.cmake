@@ -0,0 +1,123 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+cmake_minimum_required(VERSION 3.12)
+
+set(_time_trace_report_script "${CMAKE_CURRENT_LIST_DIR}/time_trace_report.py")
+
+macro(_enable_time_trace_failed)
+    if(NOT _enable_time_trace_QUIET)
+        message(STATUS "Enabling compilation time trace - failed")
+    endif()
+    return()
+endmacro()
+
+#
+# enable_time_trace([QUIET] [REQUIRED]
+#                   [GRANULARITY microseconds]   # 500 by default
+#                   [REPORT file]                # time_trace_report.csv by default
+#                   [SORT total|self|count]      # self by default
+#                   )
+#
+# Compiles all the targets defined in the current directory and below with Clang's `-ftime-trace`.
+# Every object file gets a `.json` trace next to it.
+#
+# Adds a `time_trace_report` target that aggregates all the traces found in the build tree by
+# mp-units header and by template family (e.g. `quantity_spec`, `magnitude`, `expr_*`, `formatter`)
+# and writes a CSV report to REPORT (relative paths are relative to CMAKE_BINARY_DIR). The target
+# does not trigger compilation, so the project should be built before it.
+#
+function(enable_time_trace)
+    set(_options QUIET REQUIRED)
+    set(_one_value_args GRANULARITY REPORT SORT)
+    cmake_parse_arguments(PARSE_ARGV 0 _enable_time_trace "${_options}" "${_one_value_args}" "")
+
+    # validate and process arguments
+    if(_enable_time_trace_UNPARSED_ARGUMENTS)
+        message(FATAL_ERROR "Invalid arguments '${_enable_time_trace_UNPARSED_ARGUMENTS}'")
+    endif()
+
+    if(_enable_time_trace_KEYWORDS_MISSING_VALUES)
+        message(FATAL_ERROR "No value provided for '${_enable_time_trace_KEYWORDS_MISSING_VALUES}'")
+    endif()
+
+    if(NOT _enable_time_trace_GRANULARITY)
+        set(_enable_time_trace_GRANULARITY 500)
+    endif()
+
+    if(NOT _enable_time_trace_REPORT)
+        set(_enable_time_trace_REPORT "time_trace_report.csv")
+    endif()
+    if(NOT IS_ABSOLUTE "${_enable_time_trace_REPORT}")
+        set(_enable_time_trace_REPORT "${CMAKE_BINARY_DIR}/${_enable_time_trace_REPORT}")
+    endif()
+
+    if(NOT _enable_time_trace_SORT)
+        set(_enable_time_trace_SORT self)
+    endif()
+    set(_valid_sort_values total self count)
+    if(NOT _enable_time_trace_SORT IN_LIST _valid_sort_values)
+        message(FATAL_ERROR "'SORT' should be one of ${_valid_sort_values}")
+    endif()
+
+    if(NOT _enable_time_trace_QUIET)
+        message(STATUS "Enabling compilation time trace")
+    endif()
+
+    if(${_enable_time_trace_REQUIRED})
+        set(_error_log_level FATAL_ERROR)
+    elseif(NOT _enable_time_trace_QUIET)
+        set(_error_log_level STATUS)
+    endif()
+
+    # `-ftime-trace` is supported by clang-9 and newer
+    if(NOT CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        if(DEFINED _error_log_level)
+            message(${_error_log_level} "`-ftime-trace` is not supported by ${CMAKE_CXX_COMPILER_ID}")
+        endif()
+        _enable_time_trace_failed()
+    endif()
+
+    find_package(Python3 COMPONENTS Interpreter)
+    if(NOT Python3_Interpreter_FOUND)
+        if(DEFINED _error_log_level)
+            message(${_error_log_level} "Python 3 interpreter not found")
+        endif()
+        _enable_time_trace_failed()
+    endif()
+
+    add_compile_options(-ftime-trace -ftime-trace-granularity=${_enable_time_trace_GRANULARITY})
+
+    add_custom_target(
+        time_trace_report
+        COMMAND "${Python3_EXECUTABLE}" "${_time_trace_report_script}" --sort ${_enable_time_trace_SORT} --output
+                "${_enable_time_trace_REPORT}" "${CMAKE_BINARY_DIR}"
+        COMMENT "Aggregating compilation time traces to ${_enable_time_trace_REPORT}"
+        VERBATIM USES_TERMINAL
+    )
+
+    if(NOT _enable_time_trace_QUIET)
+        message(STATUS "  Granularity: ${_enable_time_trace_GRANULARITY} us")
+        message(STATUS "  Report: ${_enable_time_trace_REPORT}")
+        message(STATUS "Enabling compilation time trace - done")
+    endif()
+endfunction()
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Aggregates Clang `-ftime-trace` output by mp-units header and by template family.
+
+Every trace event gets its self time (its duration without the durations of the events nested
+in it). Self times are summed per key. The total time of a key is summed only over the outermost
+events with that key so that recursive instantiations are not counted twice.
+"""
+
+import argparse
+import csv
+import json
+import os
+import re
+import sys
+from collections import defaultdict
+
+HEADER_EVENTS = {"Source"}
+TEMPLATE_EVENTS = {"InstantiateClass", "InstantiateFunction"}
+
+_header_re = re.compile(r"(mp-units/.+)$")
+
+
+class Stats:
+    def __init__(self):
+        self.count = 0
+        self.total = 0
+        self.self_time = 0
+        self.units = set()
+
+
+def header_key(detail):
+    match = _header_re.search(detail.replace("\\", "/"))
+    return match.group(1) if match else None
+
+
+def template_family(detail):
+    """Returns the family of the instantiated template, e.g. `quantity_spec` or `expr_*`
+
+    Only mp-units templates and templates instantiated for mp-units types (i.e. `formatter`)
+    are taken into account.
+    """
+    if "mp_units::" not in detail:
+        return None
+    name = re.split(r"[<(]", detail.strip(), 1)[0].rsplit("::", 1)[-1]
+    if not name:
+        return None
+    if name.startswith("expr_"):
+        return "expr_*"
+    return name
+
+
+def load_events(path):
+    try:
+        with open(path, encoding="utf-8") as file:
+            data = json.load(file)
+    except (OSError, ValueError):
+        return None
+    if not isinstance(data, dict) or "traceEvents" not in data:
+        return None
+    return [e for e in data["traceEvents"] if e.get("ph") == "X" and not e.get("name", "").startswith("Total ")]
+
+
+def process_unit(unit, events, stats):
+    threads = defaultdict(list)
+    for e in events:
+        threads[(e.get("pid"), e.get("tid"))].append(e)
+
+    for thread_events in threads.values():
+        # parents first for events starting at the same time
+        thread_events.sort(key=lambda e: (e["ts"], -e["dur"]))
+        stack = []  # [end, key, children duration, event]
+        active = defaultdict(int)
+
+        def close(item):
+            _, key, children, e = item
+            if key is not None:
+                active[key] -= 1
+                s = stats[key]
+                s.self_time += e["dur"] - children
+                if active[key] == 0:
+                    s.total += e["dur"]
+
+        for e in thread_events:
+            while stack and stack[-1][0] <= e["ts"]:
+                close(stack.pop())
+            if stack:
+                stack[-1][2] += e["dur"]
+
+            key = None
+            detail = e.get("args", {}).get("detail", "")
+            if e["name"] in HEADER_EVENTS:
+                header = header_key(detail)
+                key = ("header", header) if header else None
+            elif e["name"] in TEMPLATE_EVENTS:
+                family = template_family(detail)
+                key = ("template", family) if family else None
+
+            if key is not None:
+                active[key] += 1
+                s = stats[key]
+                s.count += 1
+                s.units.add(unit)
+            stack.append([e["ts"] + e["dur"], key, 0, e])
+
+        while stack:
+            close(stack.pop())
+
+
+def find_traces(paths):
+    for path in paths:
+        if os.path.isfile(path):
+            yield path
+            continue
+        for root, _, files in os.walk(path):
+            for name in files:
+                if name.endswith(".json"):
+                    yield os.path.join(root, name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("paths", nargs="+", help="trace files or directories to search for them recursively")
+    parser.add_argument("-o", "--output", help="CSV file to write the report to (stdout if not provided)")
+    parser.add_argument(
+        "-s", "--sort", choices=["total", "self", "count"], default="self", help="column to sort the report by"
+    )
+    parser.add_argument(
+        "-c", "--category", choices=["header", "template"], help="report only the given category of entries"
+    )
+    parser.add_argument("-n", "--top", type=int, default=20, help="number of entries to print (0 for none)")
+    args = parser.parse_args()
+
+    stats = defaultdict(Stats)
+    units = 0
+    for path in find_traces(args.paths):
+        events = load_events(path)
+        if events is None:
+            continue
+        units += 1
+        process_unit(path, events, stats)
+
+    if units == 0:
+        print("No time traces found in: " + ", ".join(args.paths), file=sys.stderr)
+        return 1
+
+    rows = [
+        (category, name, s.count, s.total / 1000, s.self_time / 1000, len(s.units))
+        for (category, name), s in stats.items()
+        if args.category is None or category == args.category
+    ]
+    column = {"count": 2, "total": 3, "self": 4}[args.sort]
+    rows.sort(key=lambda r: (-r[column], r[0], r[1]))
+
+    header = ["category", "name", "count", "total_ms", "self_ms", "translation_units"]
+    csv_rows = [r[:3] + (f"{r[3]:.3f}", f"{r[4]:.3f}") + r[5:] for r in rows]
+    if not args.output:
+        writer = csv.writer(sys.stdout)
+        writer.writerow(header)
+        writer.writerows(csv_rows)
+        return 0
+
+    with open(args.output, "w", newline="", encoding="utf-8") as file:
+        writer = csv.writer(file)
+        writer.writerow(header)
+        writer.writerows(csv_rows)
+
+    print(f"Aggregated {units} time traces to {args.output}")
+    if args.top > 0:
+        width = max([len(r[1]) for r in rows[: args.top]] + [4])
+        print(f"{'category':<9} {'name':<{width}} {'count':>8} {'total [ms]':>12} {'self [ms]':>12} {'TUs':>5}")
+        for r in rows[: args.top]:
+            print(f"{r[0]:<9} {r[1]:<{width}} {r[2]:>8} {r[3]:>12.1f} {r[4]:>12.1f} {r[5]:>5}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -80,8 +80,9 @@ void print(std::string_view phase_name, timestamp start_ts, const glide_computer
   std::cout << MP_UNITS_STD_FMT::format(
     "| {:<12} | {:>9%.1Q %q} (Total: {:>9%.1Q %q}) | {:>8%.1Q %q} (Total: {:>8%.1Q %q}) | {:>7%.0Q %q} ({:>6%.0Q %q}) "
     "|\n",
-    phase_name, value_cast<si::minute>(new_point.ts - point.ts), value_cast<si::minute>(new_point.ts - start_ts),
-    new_point.dist - point.dist, new_point.dist, new_point.alt - point.alt, new_point.alt);
+    phase_name, value_cast<si::minute>(value_cast<double>(new_point.ts - point.ts)),
+    value_cast<si::minute>(value_cast<double>(new_point.ts - start_ts)), new_point.dist - point.dist, new_point.dist,
+    new_point.alt - point.alt, new_point.alt);
 }
 
 flight_point takeoff(timestamp start_ts, const task& t) { return {start_ts, t.get_start().alt}; }
@@ -89,7 +90,7 @@ flight_point takeoff(timestamp start_ts, const task& t) { return {start_ts, t.ge
 flight_point tow(timestamp start_ts, const flight_point& pos, const aircraft_tow& at)
 {
   const duration d = (at.height_agl / at.performance);
-  const flight_point new_pos{pos.ts + d, pos.alt + at.height_agl, pos.leg_idx, pos.dist};
+  const flight_point new_pos{pos.ts + tick_cast<timestamp>(d), pos.alt + at.height_agl, pos.leg_idx, pos.dist};
 
   print("Tow", start_ts, pos, new_pos);
   return new_pos;
@@ -102,7 +103,7 @@ flight_point circle(timestamp start_ts, const flight_point& pos, const glider& g
   const height circling_height = std::min(w.cloud_base - h_agl, height_to_gain);
   const rate_of_climb circling_rate = w.thermal_strength + g.polar[0].climb;
   const duration d = (circling_height / circling_rate);
-  const flight_point new_pos{pos.ts + d, pos.alt + circling_height, pos.leg_idx, pos.dist};
+  const flight_point new_pos{pos.ts + tick_cast<timestamp>(d), pos.alt + circling_height, pos.leg_idx, pos.dist};
 
   height_to_gain -= circling_height;
 
@@ -118,8 +119,8 @@ flight_point glide(timestamp start_ts, const flight_point& pos, const glider& g,
   const auto alt = ground_alt + s.min_agl_height;
   const auto l3d = length_3d(dist, pos.alt - alt);
   const duration d = l3d / g.polar[0].v;
-  const flight_point new_pos{pos.ts + d, terrain_level_alt(t, pos) + s.min_agl_height, t.get_leg_index(new_distance),
-                             new_distance};
+  const flight_point new_pos{pos.ts + tick_cast<timestamp>(d), terrain_level_alt(t, pos) + s.min_agl_height,
+                             t.get_leg_index(new_distance), new_distance};
 
   print("Glide", start_ts, pos, new_pos);
   return new_pos;
@@ -130,7 +131,8 @@ flight_point final_glide(timestamp start_ts, const flight_point& pos, const glid
   const auto dist = t.get_distance() - pos.dist;
   const auto l3d = length_3d(dist, pos.alt - t.get_finish().alt);
   const duration d = l3d / g.polar[0].v;
-  const flight_point new_pos{pos.ts + d, t.get_finish().alt, t.get_legs().size() - 1, pos.dist + dist};
+  const flight_point new_pos{pos.ts + tick_cast<timestamp>(d), t.get_finish().alt, t.get_legs().size() - 1,
+                             pos.dist + dist};
 
   print("Final Glide", start_ts, pos, new_pos);
   return new_pos;
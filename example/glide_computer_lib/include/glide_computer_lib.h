@@ -61,8 +61,7 @@ using height = mp_units::quantity<mp_units::isq::height[mp_units::si::metre]>;
 
 // time
 using duration = mp_units::quantity<mp_units::isq::duration[mp_units::si::second]>;
-using timestamp = mp_units::quantity_point<mp_units::isq::time[mp_units::si::second],
-                                           mp_units::chrono_point_origin<std::chrono::system_clock>>;
+using timestamp = mp_units::chrono_timestamp<std::chrono::system_clock>;
 
 // speed
 using velocity = mp_units::quantity<mp_units::isq::speed[mp_units::si::kilo<mp_units::si::metre> / mp_units::si::hour]>;
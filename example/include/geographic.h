@@ -25,7 +25,7 @@
 #include "ranged_representation.h"
 #include <mp-units/bits/fmt_hacks.h>
 #include <mp-units/format.h>
-#include <mp-units/math.h>
+#include <mp-units/geographic.h>
 #include <mp-units/quantity.h>
 #include <mp-units/quantity_point.h>
 #include <mp-units/systems/isq/space_and_time.h>
@@ -166,35 +166,20 @@ struct position {
   longitude<T> lon;
 };
 
+template<typename T>
+mp_units::geographic_position<T> to_geographic_position(position<T> p)
+{
+  using namespace mp_units;
+  return {static_cast<T>(p.lat.quantity_from_origin().numerical_value_in(si::degree)) * si::degree,
+          static_cast<T>(p.lon.quantity_from_origin().numerical_value_in(si::degree)) * si::degree};
+}
+
 template<typename T>
 distance spherical_distance(position<T> from, position<T> to)
 {
   using namespace mp_units;
   constexpr auto earth_radius = 6'371 * isq::radius[si::kilo<si::metre>];
-
-  using isq::sin, isq::cos, isq::asin, isq::acos;
-
-  const auto& from_lat = from.lat.quantity_from_origin();
-  const auto& from_lon = from.lon.quantity_from_origin();
-  const auto& to_lat = to.lat.quantity_from_origin();
-  const auto& to_lon = to.lon.quantity_from_origin();
-
-  // https://en.wikipedia.org/wiki/Great-circle_distance#Formulae
-  if constexpr (sizeof(T) >= 8) {
-    // spherical law of cosines
-    const auto central_angle = acos(sin(from_lat) * sin(to_lat) + cos(from_lat) * cos(to_lat) * cos(to_lon - from_lon));
-    // const auto central_angle = 2 * asin(sqrt(0.5 - cos(to_lat - from_lat) / 2 + cos(from_lat) * cos(to_lat) * (1
-    // - cos(lon2_rad - from_lon)) / 2));
-
-    return quantity_cast<isq::distance>(earth_radius * central_angle);
-  } else {
-    // the haversine formula
-    const auto sin_lat = sin((to_lat - from_lat) / 2);
-    const auto sin_lon = sin((to_lon - from_lon) / 2);
-    const auto central_angle = 2 * asin(sqrt(sin_lat * sin_lat + cos(from_lat) * cos(to_lat) * sin_lon * sin_lon));
-
-    return quantity_cast<isq::distance>(earth_radius * central_angle);
-  }
+  return haversine_distance(to_geographic_position(from), to_geographic_position(to), earth_radius);
 }
 
 }  // namespace geographic
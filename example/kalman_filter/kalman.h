@@ -75,7 +75,9 @@ private:
   static constexpr auto uncertainty_ref = QQP::reference * QQP::reference;
   using uncertainty_type = mp_units::quantity<uncertainty_ref, typename QQP::rep>;
 public:
-  kalman::state<QQP, QQPs...> state;  // TODO extend kalman functions to work with this variadic parameter list
+  // only the first state variable has its uncertainty here (see `mp_units::kalman_filter` in
+  // _mp-units/kalman_filter.h_ for N-state filters with a full covariance matrix)
+  kalman::state<QQP, QQPs...> state;
   uncertainty_type uncertainty;
 };
 
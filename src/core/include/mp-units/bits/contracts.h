@@ -0,0 +1,156 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <mp-units/bits/external/hacks.h>
+
+// Policies of checking the preconditions of quantity arithmetic (i.e. a division by zero).
+// `MP_UNITS_QUANTITY_CONTRACTS` should be set to one of the below:
+// - `MP_UNITS_CONTRACTS_OFF` - no checks,
+// - `MP_UNITS_CONTRACTS_GSL` (default) - `gsl_ExpectsAudit` (enabled with `gsl_CONFIG_CONTRACT_CHECKING_AUDIT`),
+// - `MP_UNITS_CONTRACTS_ASSERT` - `assert` (disabled with `NDEBUG`),
+// - `MP_UNITS_CONTRACTS_TRAP` - abnormal program termination without any diagnostics,
+// - `MP_UNITS_CONTRACTS_HOOK` - counts violations and calls a user-provided handler
+//   (see `set_contract_violation_handler()`); if the handler returns, the operation is still performed
+//   for floating-point representation types, and `std::terminate()` is called otherwise (i.e. an integral
+//   division by zero is undefined behavior).
+//
+// `MP_UNITS_QUANTITY_EXPECTS(Rep, expr)` checks `expr` for an operation performed on the `Rep` divisor type.
+#define MP_UNITS_CONTRACTS_OFF 0
+#define MP_UNITS_CONTRACTS_GSL 1
+#define MP_UNITS_CONTRACTS_ASSERT 2
+#define MP_UNITS_CONTRACTS_TRAP 3
+#define MP_UNITS_CONTRACTS_HOOK 4
+
+#ifndef MP_UNITS_QUANTITY_CONTRACTS
+#define MP_UNITS_QUANTITY_CONTRACTS MP_UNITS_CONTRACTS_GSL
+#endif
+
+#if MP_UNITS_QUANTITY_CONTRACTS == MP_UNITS_CONTRACTS_OFF
+
+#define MP_UNITS_QUANTITY_EXPECTS(Rep, expr) static_cast<void>(0)
+
+#elif MP_UNITS_QUANTITY_CONTRACTS == MP_UNITS_CONTRACTS_GSL
+
+#include <gsl/gsl-lite.hpp>
+
+#define MP_UNITS_QUANTITY_EXPECTS(Rep, expr) gsl_ExpectsAudit(expr)
+
+#elif MP_UNITS_QUANTITY_CONTRACTS == MP_UNITS_CONTRACTS_ASSERT
+
+#include <cassert>
+
+#define MP_UNITS_QUANTITY_EXPECTS(Rep, expr) assert(expr)
+
+#elif MP_UNITS_QUANTITY_CONTRACTS == MP_UNITS_CONTRACTS_TRAP
+
+#if MP_UNITS_COMP_MSVC
+
+#include <cstdlib>
+
+#define MP_UNITS_QUANTITY_EXPECTS(Rep, expr) ((expr) ? static_cast<void>(0) : std::abort())
+
+#else
+
+#define MP_UNITS_QUANTITY_EXPECTS(Rep, expr) ((expr) ? static_cast<void>(0) : __builtin_trap())
+
+#endif
+
+#elif MP_UNITS_QUANTITY_CONTRACTS == MP_UNITS_CONTRACTS_HOOK
+
+#include <mp-units/customization_points.h>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <source_location>
+
+namespace mp_units {
+
+/**
+ * @brief Information about a violated precondition of a quantity operation
+ *
+ * `location` points to the check in the library, and its `function_name()` provides the signature
+ * of the operation together with the types of quantities involved.
+ */
+struct contract_violation {
+  const char* expression;
+  std::source_location location;
+};
+
+using contract_violation_handler = void (*)(const contract_violation&);
+
+namespace detail {
+
+inline std::atomic<std::size_t> contract_violations_count = 0;
+inline std::atomic<contract_violation_handler> contract_violations_handler = nullptr;
+
+template<typename Rep>
+void on_contract_violation(const char* expression, const std::source_location& location)
+{
+  contract_violations_count.fetch_add(1, std::memory_order_relaxed);
+  if (const contract_violation_handler handler = contract_violations_handler.load(std::memory_order_acquire))
+    handler(contract_violation{expression, location});
+  // the operation can't be performed if the handler returns
+  if constexpr (!treat_as_floating_point<Rep>) std::terminate();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Returns the number of contract violations since the start of the program or the last reset
+ */
+[[nodiscard]] inline std::size_t contract_violations() noexcept
+{
+  return detail::contract_violations_count.load(std::memory_order_relaxed);
+}
+
+inline void reset_contract_violations() noexcept
+{
+  detail::contract_violations_count.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Installs a handler called on every contract violation
+ *
+ * The handler may log the violation, throw an exception, or terminate the program.
+ *
+ * @param handler a new handler or `nullptr` to only count violations
+ * @return the previously installed handler
+ */
+inline contract_violation_handler set_contract_violation_handler(contract_violation_handler handler) noexcept
+{
+  return detail::contract_violations_handler.exchange(handler, std::memory_order_acq_rel);
+}
+
+}  // namespace mp_units
+
+#define MP_UNITS_QUANTITY_EXPECTS(Rep, expr) \
+  ((expr) ? static_cast<void>(0)             \
+          : ::mp_units::detail::on_contract_violation<Rep>(#expr, std::source_location::current()))
+
+#else
+
+#error "Unknown MP_UNITS_QUANTITY_CONTRACTS value"
+
+#endif
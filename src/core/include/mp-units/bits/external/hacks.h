@@ -117,6 +117,27 @@
 
 #endif
 
+#ifndef MP_UNITS_FORCE_INLINE
+#define MP_UNITS_FORCE_INLINE 0
+#endif
+
+#if MP_UNITS_FORCE_INLINE && MP_UNITS_COMP_MSVC
+
+#define MP_UNITS_ALWAYS_INLINE __forceinline
+
+#elif MP_UNITS_FORCE_INLINE
+
+#define MP_UNITS_ALWAYS_INLINE [[gnu::always_inline, gnu::artificial]]
+
+#else
+
+#define MP_UNITS_ALWAYS_INLINE
+
+#endif
+
+// the same as `std::forward<decltype(X)>(X)` but not a function call in unoptimized builds
+#define MP_UNITS_FWD(X) static_cast<decltype(X)&&>(X)
+
 #if MP_UNITS_COMP_MSVC
 
 #define MP_UNITS_CONSTRAINED_AUTO_WORKAROUND(X)
@@ -47,7 +47,7 @@ namespace mp_units {
  */
 template<QuantitySpec auto ToQS, typename Q>
   requires Quantity<std::remove_cvref_t<Q>> && (castable(Q::quantity_spec, ToQS))
-[[nodiscard]] constexpr Quantity auto quantity_cast(Q&& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto quantity_cast(Q&& q)
 {
   if constexpr (detail::QuantityKindSpec<std::remove_const_t<decltype(ToQS)>> &&
                 AssociatedUnit<std::remove_const_t<decltype(Q::unit)>>)
@@ -57,16 +57,14 @@ template<Quantity To, typename From>
              std::constructible_from<typename To::rep, typename std::remove_reference_t<From>::rep>) ||
             (std::remove_reference_t<From>::unit != To::unit))  // && scalable_with_<typename To::rep>))
 // TODO how to constrain the second part here?
-[[nodiscard]] constexpr Quantity auto sudo_cast(From&& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto sudo_cast(From&& q)
 {
   constexpr auto q_unit = std::remove_reference_t<From>::unit;
   if constexpr (q_unit == To::unit) {
     // no scaling of the number needed
-    return make_quantity<To::reference>(static_cast<MP_UNITS_TYPENAME To::rep>(
-      std::forward<From>(q).numerical_value()));  // this is the only (and recommended) way to do
-                                                  // a truncating conversion on a number, so we are
-                                                  // using static_cast to suppress all the compiler
-                                                  // warnings on conversions
+    // this is the only (and recommended) way to do a truncating conversion on a number, so we are using
+    // static_cast to suppress all the compiler warnings on conversions
+    return make_quantity<To::reference>(static_cast<MP_UNITS_TYPENAME To::rep>(MP_UNITS_FWD(q).numerical_value()));
   } else {
     // scale the number
     constexpr Magnitude auto c_mag = get_canonical_unit(q_unit).mag / get_canonical_unit(To::unit).mag;
@@ -77,10 +75,12 @@ template<Quantity To, typename From>
     using c_mag_type = common_magnitude_type<c_mag>;
     using multiplier_type =
       conditional<treat_as_floating_point<c_rep_type>, std::common_type_t<c_mag_type, long double>, c_mag_type>;
-    constexpr auto val = [](Magnitude auto m) { return get_value<multiplier_type>(m); };
-    return static_cast<MP_UNITS_TYPENAME To::rep>(static_cast<c_rep_type>(std::forward<From>(q).numerical_value()) *
-                                                  val(num) / val(den) * val(irr)) *
-           To::reference;
+    // precompute the factors so that no helper function is called at runtime
+    constexpr multiplier_type num_value = get_value<multiplier_type>(num);
+    constexpr multiplier_type den_value = get_value<multiplier_type>(den);
+    constexpr multiplier_type irr_value = get_value<multiplier_type>(irr);
+    return make_quantity<To::reference>(static_cast<MP_UNITS_TYPENAME To::rep>(
+      static_cast<c_rep_type>(MP_UNITS_FWD(q).numerical_value()) * num_value / den_value * irr_value));
   }
 }
 
@@ -41,7 +41,7 @@ namespace mp_units {
  * @tparam ToU a unit to use for a target quantity
  */
 template<Unit auto ToU, typename Q>
-[[nodiscard]] constexpr Quantity auto value_cast(Q&& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto value_cast(Q&& q)
   requires Quantity<std::remove_cvref_t<Q>> && (convertible(std::remove_reference_t<Q>::reference, ToU))
 {
   using q_type = std::remove_reference_t<Q>;
@@ -69,7 +69,7 @@ template<Representation ToRep, typename Q>
   requires Quantity<std::remove_cvref_t<Q>> &&
            RepresentationOf<ToRep, std::remove_reference_t<Q>::quantity_spec.character> &&
            std::constructible_from<ToRep, typename std::remove_reference_t<Q>::rep>
-[[nodiscard]] constexpr quantity<std::remove_reference_t<Q>::reference, ToRep> value_cast(Q&& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity<std::remove_reference_t<Q>::reference, ToRep> value_cast(Q&& q)
 {
   return detail::sudo_cast<quantity<std::remove_reference_t<Q>::reference, ToRep>>(std::forward<Q>(q));
 }
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <mp-units/bits/contracts.h>
 #include <mp-units/bits/dimension_concepts.h>
 #include <mp-units/bits/quantity_concepts.h>
 #include <mp-units/bits/quantity_spec_concepts.h>
@@ -95,25 +96,25 @@ public:
   using rep = Rep;
 
   // static member functions
-  [[nodiscard]] static constexpr quantity zero() noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE static constexpr quantity zero() noexcept
     requires requires { quantity_values<rep>::zero(); }
   {
     return quantity(quantity_values<rep>::zero());
   }
 
-  [[nodiscard]] static constexpr quantity one() noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE static constexpr quantity one() noexcept
     requires requires { quantity_values<rep>::one(); }
   {
     return quantity(quantity_values<rep>::one());
   }
 
-  [[nodiscard]] static constexpr quantity min() noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE static constexpr quantity min() noexcept
     requires requires { quantity_values<rep>::min(); }
   {
     return quantity(quantity_values<rep>::min());
   }
 
-  [[nodiscard]] static constexpr quantity max() noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE static constexpr quantity max() noexcept
     requires requires { quantity_values<rep>::max(); }
   {
     return quantity(quantity_values<rep>::max());
@@ -125,7 +126,7 @@ public:
   quantity(quantity&&) = default;
 
   template<detail::QuantityConvertibleTo<quantity> Q>
-  constexpr explicit(!std::convertible_to<typename Q::rep, Rep>) quantity(const Q& q) :
+  MP_UNITS_ALWAYS_INLINE constexpr explicit(!std::convertible_to<typename Q::rep, Rep>) quantity(const Q& q) :
       value_(detail::sudo_cast<quantity>(q).numerical_value())
   {
   }
@@ -133,7 +134,7 @@ public:
   template<QuantityLike Q>
     requires detail::QuantityConvertibleTo<
       quantity<quantity_like_traits<Q>::reference, typename quantity_like_traits<Q>::rep>, quantity>
-  constexpr explicit quantity(const Q& q) :
+  MP_UNITS_ALWAYS_INLINE constexpr explicit quantity(const Q& q) :
       quantity(make_quantity<quantity_like_traits<Q>::reference>(quantity_like_traits<Q>::value(q)))
   {
   }
@@ -144,33 +145,39 @@ public:
   // data access
 #ifdef __cpp_explicit_this_parameter
   template<typename Self>
-  [[nodiscard]] constexpr auto&& value(this Self&& self) noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr auto&& value(this Self&& self) noexcept
   {
-    return std::forward<Self>(self).value_;
+    return MP_UNITS_FWD(self).value_;
   }
 #else
-  [[nodiscard]] constexpr rep& numerical_value() & noexcept { return value_; }
-  [[nodiscard]] constexpr const rep& numerical_value() const& noexcept { return value_; }
-  [[nodiscard]] constexpr rep&& numerical_value() && noexcept { return std::move(value_); }
-  [[nodiscard]] constexpr const rep&& numerical_value() const&& noexcept { return std::move(value_); }
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr rep& numerical_value() & noexcept { return value_; }
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr const rep& numerical_value() const& noexcept { return value_; }
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr rep&& numerical_value() && noexcept
+  {
+    return static_cast<rep&&>(value_);
+  }
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr const rep&& numerical_value() const&& noexcept
+  {
+    return static_cast<const rep&&>(value_);
+  }
 #endif
 
   template<Unit U>
     requires requires(quantity q) { q.in(U{}); }
-  [[nodiscard]] constexpr rep numerical_value_in(U) const noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr rep numerical_value_in(U) const noexcept
   {
     return (*this).in(U{}).numerical_value();
   }
 
   template<Unit U>
     requires detail::QuantityConvertibleTo<quantity, quantity<quantity_spec[U{}], Rep>>
-  [[nodiscard]] constexpr quantity<quantity_spec[U{}], Rep> in(U) const
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity<quantity_spec[U{}], Rep> in(U) const
   {
     return quantity<quantity_spec[U{}], Rep>{*this};
   }
 
   // member unary operators
-  [[nodiscard]] constexpr Quantity auto operator+() const
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator+() const
     requires requires(rep v) {
       {
         +v
@@ -180,7 +187,7 @@ public:
     return make_quantity<reference>(+numerical_value());
   }
 
-  [[nodiscard]] constexpr Quantity auto operator-() const
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator-() const
     requires requires(rep v) {
       {
         -v
@@ -190,7 +197,7 @@ public:
     return make_quantity<reference>(-numerical_value());
   }
 
-  constexpr quantity& operator++()
+  MP_UNITS_ALWAYS_INLINE constexpr quantity& operator++()
     requires requires(rep v) {
       {
         ++v
@@ -201,7 +208,7 @@ public:
     return *this;
   }
 
-  [[nodiscard]] constexpr Quantity auto operator++(int)
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator++(int)
     requires requires(rep v) {
       {
         v++
@@ -211,7 +218,7 @@ public:
     return make_quantity<reference>(value_++);
   }
 
-  constexpr quantity& operator--()
+  MP_UNITS_ALWAYS_INLINE constexpr quantity& operator--()
     requires requires(rep v) {
       {
         --v
@@ -222,7 +229,7 @@ public:
     return *this;
   }
 
-  [[nodiscard]] constexpr Quantity auto operator--(int)
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator--(int)
     requires requires(rep v) {
       {
         v--
@@ -233,7 +240,7 @@ public:
   }
 
   // compound assignment operators
-  constexpr quantity& operator+=(const quantity& q)
+  MP_UNITS_ALWAYS_INLINE constexpr quantity& operator+=(const quantity& q)
     requires requires(rep a, rep b) {
       {
         a += b
@@ -244,7 +251,7 @@ public:
     return *this;
   }
 
-  constexpr quantity& operator-=(const quantity& q)
+  MP_UNITS_ALWAYS_INLINE constexpr quantity& operator-=(const quantity& q)
     requires requires(rep a, rep b) {
       {
         a -= b
@@ -255,14 +262,14 @@ public:
     return *this;
   }
 
-  constexpr quantity& operator%=(const quantity& q)
+  MP_UNITS_ALWAYS_INLINE constexpr quantity& operator%=(const quantity& q)
     requires(!treat_as_floating_point<rep>) && requires(rep a, rep b) {
       {
         a %= b
       } -> std::same_as<rep&>;
     }
   {
-    gsl_ExpectsAudit(q.numerical_value() != quantity_values<rep>::zero());
+    MP_UNITS_QUANTITY_EXPECTS(rep, q.numerical_value() != quantity_values<rep>::zero());
     value_ %= q.numerical_value();
     return *this;
   }
@@ -273,7 +280,7 @@ public:
         a *= b
       } -> std::same_as<rep&>;
     }
-  constexpr quantity& operator*=(const Value& v)
+  MP_UNITS_ALWAYS_INLINE constexpr quantity& operator*=(const Value& v)
   {
     value_ *= v;
     return *this;
@@ -285,7 +292,7 @@ public:
         a *= b
       } -> std::same_as<rep&>;
     }
-  constexpr quantity& operator*=(const Q& rhs)
+  MP_UNITS_ALWAYS_INLINE constexpr quantity& operator*=(const Q& rhs)
   {
     value_ *= rhs.numerical_value();
     return *this;
@@ -297,9 +304,9 @@ public:
         a /= b
       } -> std::same_as<rep&>;
     }
-  constexpr quantity& operator/=(const Value& v)
+  MP_UNITS_ALWAYS_INLINE constexpr quantity& operator/=(const Value& v)
   {
-    gsl_ExpectsAudit(v != quantity_values<Value>::zero());
+    MP_UNITS_QUANTITY_EXPECTS(Value, v != quantity_values<Value>::zero());
     value_ /= v;
     return *this;
   }
@@ -310,9 +317,9 @@ public:
         a /= b
       } -> std::same_as<rep&>;
     }
-  constexpr quantity& operator/=(const Q& rhs)
+  MP_UNITS_ALWAYS_INLINE constexpr quantity& operator/=(const Q& rhs)
   {
-    gsl_ExpectsAudit(rhs.numerical_value() != quantity_values<typename Q::rep>::zero());
+    MP_UNITS_QUANTITY_EXPECTS(typename Q::rep, rhs.numerical_value() != quantity_values<typename Q::rep>::zero());
     value_ /= rhs.numerical_value();
     return *this;
   }
@@ -327,7 +334,7 @@ private:
 
   template<typename Value>
     requires std::constructible_from<rep, Value&&>
-  constexpr explicit quantity(Value&& v) : value_(std::forward<Value>(v))
+  MP_UNITS_ALWAYS_INLINE constexpr explicit quantity(Value&& v) : value_(MP_UNITS_FWD(v))
   {
   }
 };
@@ -339,7 +346,8 @@ explicit quantity(Q) -> quantity<quantity_like_traits<Q>::reference, typename qu
 // binary operators on quantities
 template<auto R1, typename Rep1, auto R2, typename Rep2>
   requires detail::InvocableQuantities<std::plus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>
-[[nodiscard]] constexpr Quantity auto operator+(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator+(const quantity<R1, Rep1>& lhs,
+                                                                       const quantity<R2, Rep2>& rhs)
 {
   using ret = detail::common_quantity_for<std::plus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>;
   return make_quantity<ret::reference>(ret(lhs).numerical_value() + ret(rhs).numerical_value());
@@ -347,7 +355,8 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
 
 template<auto R1, typename Rep1, auto R2, typename Rep2>
   requires detail::InvocableQuantities<std::minus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>
-[[nodiscard]] constexpr Quantity auto operator-(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator-(const quantity<R1, Rep1>& lhs,
+                                                                       const quantity<R2, Rep2>& rhs)
 {
   using ret = detail::common_quantity_for<std::minus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>;
   return make_quantity<ret::reference>(ret(lhs).numerical_value() - ret(rhs).numerical_value());
@@ -356,9 +365,10 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
 template<auto R1, typename Rep1, auto R2, typename Rep2>
   requires(!treat_as_floating_point<Rep1>) && (!treat_as_floating_point<Rep2>) &&
           detail::InvocableQuantities<std::modulus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>
-[[nodiscard]] constexpr Quantity auto operator%(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator%(const quantity<R1, Rep1>& lhs,
+                                                                       const quantity<R2, Rep2>& rhs)
 {
-  gsl_ExpectsAudit(rhs.numerical_value() != quantity_values<Rep1>::zero());
+  MP_UNITS_QUANTITY_EXPECTS(Rep2, rhs.numerical_value() != quantity_values<Rep1>::zero());
   using ret = detail::common_quantity_for<std::modulus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>;
   return make_quantity<ret::reference>(ret(lhs).numerical_value() % ret(rhs).numerical_value());
 }
@@ -366,7 +376,8 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
 template<auto R1, typename Rep1, auto R2, typename Rep2>
   requires detail::InvokeResultOf<(get_quantity_spec(R1) * get_quantity_spec(R2)).character, std::multiplies<>, Rep1,
                                   Rep2>
-[[nodiscard]] constexpr Quantity auto operator*(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator*(const quantity<R1, Rep1>& lhs,
+                                                                       const quantity<R2, Rep2>& rhs)
 {
   return make_quantity<R1 * R2>(lhs.numerical_value() * rhs.numerical_value());
 }
@@ -374,7 +385,7 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
 template<auto R, typename Rep, typename Value>
   requires(!Quantity<Value>) &&
           detail::InvokeResultOf<get_quantity_spec(R).character, std::multiplies<>, Rep, const Value&>
-[[nodiscard]] constexpr Quantity auto operator*(const quantity<R, Rep>& q, const Value& v)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator*(const quantity<R, Rep>& q, const Value& v)
 {
   return make_quantity<R>(q.numerical_value() * v);
 }
@@ -382,32 +393,33 @@ template<auto R, typename Rep, typename Value>
 template<typename Value, auto R, typename Rep>
   requires(!Quantity<Value>) &&
           detail::InvokeResultOf<get_quantity_spec(R).character, std::multiplies<>, const Value&, Rep>
-[[nodiscard]] constexpr Quantity auto operator*(const Value& v, const quantity<R, Rep>& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator*(const Value& v, const quantity<R, Rep>& q)
 {
   return make_quantity<R>(v * q.numerical_value());
 }
 
 template<auto R1, typename Rep1, auto R2, typename Rep2>
   requires detail::InvokeResultOf<(get_quantity_spec(R1) / get_quantity_spec(R2)).character, std::divides<>, Rep1, Rep2>
-[[nodiscard]] constexpr Quantity auto operator/(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator/(const quantity<R1, Rep1>& lhs,
+                                                                       const quantity<R2, Rep2>& rhs)
 {
-  gsl_ExpectsAudit(rhs.numerical_value() != quantity_values<Rep2>::zero());
+  MP_UNITS_QUANTITY_EXPECTS(Rep2, rhs.numerical_value() != quantity_values<Rep2>::zero());
   return make_quantity<R1 / R2>(lhs.numerical_value() / rhs.numerical_value());
 }
 
 template<auto R, typename Rep, typename Value>
   requires(!Quantity<Value>) &&
           detail::InvokeResultOf<get_quantity_spec(R).character, std::divides<>, Rep, const Value&>
-[[nodiscard]] constexpr Quantity auto operator/(const quantity<R, Rep>& q, const Value& v)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator/(const quantity<R, Rep>& q, const Value& v)
 {
-  gsl_ExpectsAudit(v != quantity_values<Value>::zero());
+  MP_UNITS_QUANTITY_EXPECTS(Value, v != quantity_values<Value>::zero());
   return make_quantity<R>(q.numerical_value() / v);
 }
 
 template<typename Value, auto R, typename Rep>
   requires(!Quantity<Value>) &&
           detail::InvokeResultOf<get_quantity_spec(R).character, std::divides<>, const Value&, Rep>
-[[nodiscard]] constexpr Quantity auto operator/(const Value& v, const quantity<R, Rep>& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator/(const Value& v, const quantity<R, Rep>& q)
 {
   return make_quantity<::mp_units::one / R>(v / q.numerical_value());
 }
@@ -415,7 +427,8 @@ template<typename Value, auto R, typename Rep>
 template<auto R1, typename Rep1, auto R2, typename Rep2>
   requires requires { typename std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>; } &&
            std::equality_comparable<typename std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>::rep>
-[[nodiscard]] constexpr bool operator==(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr bool operator==(const quantity<R1, Rep1>& lhs,
+                                                               const quantity<R2, Rep2>& rhs)
 {
   using ct = std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>;
   return ct(lhs).numerical_value() == ct(rhs).numerical_value();
@@ -424,7 +437,8 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
 template<auto R1, typename Rep1, auto R2, typename Rep2>
   requires requires { typename std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>; } &&
            std::three_way_comparable<typename std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>::rep>
-[[nodiscard]] constexpr auto operator<=>(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr auto operator<=>(const quantity<R1, Rep1>& lhs,
+                                                                const quantity<R2, Rep2>& rhs)
 {
   using ct = std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>;
   return ct(lhs).numerical_value() <=> ct(rhs).numerical_value();
@@ -436,9 +450,9 @@ template<auto R, typename Rep>
 #else
 template<Reference auto R, typename Rep>
 #endif
-[[nodiscard]] constexpr quantity<R, std::remove_cvref_t<Rep>> make_quantity(Rep&& v)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity<R, std::remove_cvref_t<Rep>> make_quantity(Rep&& v)
 {
-  return quantity<R, std::remove_cvref_t<Rep>>(std::forward<Rep>(v));
+  return quantity<R, std::remove_cvref_t<Rep>>(MP_UNITS_FWD(v));
 }
 
 }  // namespace mp_units
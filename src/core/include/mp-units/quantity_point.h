@@ -26,6 +26,7 @@
 #include <mp-units/customization_points.h>
 #include <mp-units/quantity.h>
 #include <compare>
+#include <iterator>
 
 namespace mp_units {
 
@@ -57,6 +58,46 @@ namespace detail {
     return po;
 }
 
+/**
+ * @brief The affine map between numerical values of quantity points of the same absolute origin
+ *
+ * `to = from * scale + offset` where `scale` converts `FromU` to `ToU` and `offset` is the distance
+ * between `FromPO` and `ToPO` expressed in `ToU`. Both factors are computed at compile time
+ * with `long double` precision and rounded to `T`.
+ *
+ * @tparam T a floating-point type to perform the conversion in
+ */
+template<Unit auto FromU, PointOrigin auto FromPO, Unit auto ToU, PointOrigin auto ToPO, std::floating_point T>
+struct point_affine_map {
+  static constexpr long double offset_ld = [] {
+    if constexpr (is_same_v<std::remove_const_t<decltype(FromPO)>, std::remove_const_t<decltype(ToPO)>>)
+      return 0.L;
+    else {
+      constexpr Quantity auto q = FromPO - ToPO;
+      return static_cast<long double>(q.numerical_value()) *
+             get_value<long double>(get_canonical_unit(q.unit).mag / get_canonical_unit(ToU).mag);
+    }
+  }();
+  static constexpr Magnitude auto scale_mag = get_canonical_unit(FromU).mag / get_canonical_unit(ToU).mag;
+  static constexpr T scale = static_cast<T>(get_value<long double>(scale_mag));
+  static constexpr T offset = static_cast<T>(offset_ld);
+
+  template<typename Rep>
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE static constexpr T apply(const Rep& v)
+  {
+    if constexpr (scale_mag == mag<1>)
+      return static_cast<T>(v) + offset;
+    else if constexpr (offset_ld == 0)
+      return static_cast<T>(v) * scale;
+    else
+      return static_cast<T>(v) * scale + offset;
+  }
+};
+
+template<typename FromRep, typename ToRep>
+concept FusablePointConversion =
+  std::floating_point<ToRep> && (std::floating_point<FromRep> || std::integral<FromRep>);
+
 }  // namespace detail
 
 /**
@@ -85,19 +126,19 @@ public:
   quantity_type q_;  // needs to be public for a structural type
 
   // static member functions
-  [[nodiscard]] static constexpr quantity_point zero() noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE static constexpr quantity_point zero() noexcept
     requires requires { quantity_type::zero(); }
   {
     return quantity_point(quantity_type::zero());
   }
 
-  [[nodiscard]] static constexpr quantity_point min() noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE static constexpr quantity_point min() noexcept
     requires requires { quantity_type::min(); }
   {
     return quantity_point{quantity_type::min()};
   }
 
-  [[nodiscard]] static constexpr quantity_point max() noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE static constexpr quantity_point max() noexcept
     requires requires { quantity_type::max(); }
   {
     return quantity_point{quantity_type::max()};
@@ -111,12 +152,16 @@ public:
   template<QuantityPointOf<absolute_point_origin> QP>
     requires std::constructible_from<quantity_type, typename QP::quantity_type>
   // TODO add perfect forwarding
-  constexpr explicit(!std::convertible_to<typename QP::quantity_type, quantity_type>) quantity_point(const QP& qp) :
+  MP_UNITS_ALWAYS_INLINE constexpr explicit(!std::convertible_to<typename QP::quantity_type, quantity_type>)
+  quantity_point(const QP& qp) :
       q_([&] {
         if constexpr (is_same_v<std::remove_const_t<decltype(point_origin)>,
                                 std::remove_const_t<decltype(QP::point_origin)>>)
           return qp.quantity_from_origin();
-        else
+        else if constexpr (detail::FusablePointConversion<typename QP::rep, rep>) {
+          using map = detail::point_affine_map<QP::unit, QP::point_origin, unit, point_origin, rep>;
+          return make_quantity<reference>(map::apply(qp.quantity_from_origin().numerical_value()));
+        } else
           return qp - point_origin;
       }())
   {
@@ -128,7 +173,8 @@ public:
              std::convertible_to<
                quantity<quantity_point_like_traits<QP>::reference, typename quantity_point_like_traits<QP>::rep>,
                quantity_type>
-  constexpr explicit quantity_point(const QP& qp) : q_(quantity_point_like_traits<QP>::quantity_from_origin(qp))
+  MP_UNITS_ALWAYS_INLINE constexpr explicit quantity_point(const QP& qp) :
+      q_(quantity_point_like_traits<QP>::quantity_from_origin(qp))
   {
   }
 
@@ -136,7 +182,7 @@ public:
   quantity_point& operator=(quantity_point&&) = default;
 
   template<PointOriginFor<quantity_spec> NewPO>
-  [[nodiscard]] constexpr QuantityPointOf<NewPO{}> auto point_for(NewPO new_origin) const
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr QuantityPointOf<NewPO{}> auto point_for(NewPO new_origin) const
   {
     if constexpr (is_same_v<NewPO, std::remove_const_t<decltype(point_origin)>>)
       return *this;
@@ -147,60 +193,70 @@ public:
   // data access
 #ifdef __cpp_explicit_this_parameter
   template<typename Self>
-  [[nodiscard]] constexpr auto&& quantity_from_origin(this Self&& self) noexcept
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr auto&& quantity_from_origin(this Self&& self) noexcept
   {
-    return std::forward<Self>(self).q_;
+    return MP_UNITS_FWD(self).q_;
   }
 #else
-  [[nodiscard]] constexpr quantity_type& quantity_from_origin() & noexcept { return q_; }
-  [[nodiscard]] constexpr const quantity_type& quantity_from_origin() const& noexcept { return q_; }
-  [[nodiscard]] constexpr quantity_type&& quantity_from_origin() && noexcept { return std::move(q_); }
-  [[nodiscard]] constexpr const quantity_type&& quantity_from_origin() const&& noexcept { return std::move(q_); }
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity_type& quantity_from_origin() & noexcept { return q_; }
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr const quantity_type& quantity_from_origin() const& noexcept
+  {
+    return q_;
+  }
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity_type&& quantity_from_origin() && noexcept
+  {
+    return static_cast<quantity_type&&>(q_);
+  }
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr const quantity_type&& quantity_from_origin() const&& noexcept
+  {
+    return static_cast<const quantity_type&&>(q_);
+  }
 #endif
 
   template<Unit U>
     requires detail::QuantityConvertibleTo<quantity_type, quantity<::mp_units::reference<quantity_spec, U{}>{}, Rep>>
-  [[nodiscard]] constexpr quantity_point<::mp_units::reference<quantity_spec, U{}>{}, PO, Rep> in(U) const
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity_point<::mp_units::reference<quantity_spec, U{}>{}, PO, Rep>
+  in(U) const
   {
     return make_quantity_point<PO>(quantity_from_origin().in(U{}));
   }
 
   // member unary operators
-  constexpr quantity_point& operator++()
+  MP_UNITS_ALWAYS_INLINE constexpr quantity_point& operator++()
     requires requires { ++q_; }
   {
     ++q_;
     return *this;
   }
 
-  [[nodiscard]] constexpr quantity_point operator++(int)
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity_point operator++(int)
     requires requires { q_++; }
   {
     return quantity_point(q_++);
   }
 
-  constexpr quantity_point& operator--()
+  MP_UNITS_ALWAYS_INLINE constexpr quantity_point& operator--()
     requires requires { --q_; }
   {
     --q_;
     return *this;
   }
 
-  [[nodiscard]] constexpr quantity_point operator--(int)
+  [[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity_point operator--(int)
     requires requires { q_--; }
   {
     return quantity_point(q_--);
   }
 
   // compound assignment operators
-  constexpr quantity_point& operator+=(const quantity_type& q)
+  MP_UNITS_ALWAYS_INLINE constexpr quantity_point& operator+=(const quantity_type& q)
     requires requires { q_ += q; }
   {
     q_ += q;
     return *this;
   }
 
-  constexpr quantity_point& operator-=(const quantity_type& q)
+  MP_UNITS_ALWAYS_INLINE constexpr quantity_point& operator-=(const quantity_type& q)
     requires requires { q_ -= q; }
   {
     q_ -= q;
@@ -219,7 +275,7 @@ private:
   template<Quantity Q>
     requires std::constructible_from<quantity_type, Q> &&
              ReferenceOf<std::remove_const_t<decltype(Q::reference)>, PO.quantity_spec>
-  constexpr explicit quantity_point(Q&& q) : q_(std::forward<Q>(q))
+  MP_UNITS_ALWAYS_INLINE constexpr explicit quantity_point(Q&& q) : q_(MP_UNITS_FWD(q))
   {
   }
 };
@@ -233,8 +289,8 @@ explicit quantity_point(QP)
 template<auto R1, auto PO1, typename Rep1, auto R2, typename Rep2>
 // TODO simplify when gcc catches up
   requires ReferenceOf<std::remove_const_t<decltype(R2)>, PO1.quantity_spec>
-[[nodiscard]] constexpr QuantityPoint auto operator+(const quantity_point<R1, PO1, Rep1>& qp,
-                                                     const quantity<R2, Rep2>& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr QuantityPoint auto operator+(const quantity_point<R1, PO1, Rep1>& qp,
+                                                                            const quantity<R2, Rep2>& q)
   requires requires { qp.quantity_from_origin() + q; }
 {
   return make_quantity_point<PO1>(qp.quantity_from_origin() + q);
@@ -243,8 +299,8 @@ template<auto R1, auto PO1, typename Rep1, auto R2, typename Rep2>
 template<auto R1, typename Rep1, auto R2, auto PO2, typename Rep2>
 // TODO simplify when gcc catches up
   requires ReferenceOf<std::remove_const_t<decltype(R1)>, PO2.quantity_spec>
-[[nodiscard]] constexpr QuantityPoint auto operator+(const quantity<R1, Rep1>& q,
-                                                     const quantity_point<R2, PO2, Rep2>& qp)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr QuantityPoint auto operator+(const quantity<R1, Rep1>& q,
+                                                                            const quantity_point<R2, PO2, Rep2>& qp)
   requires requires { q + qp.quantity_from_origin(); }
 {
   return qp + q;
@@ -252,23 +308,24 @@ template<auto R1, typename Rep1, auto R2, auto PO2, typename Rep2>
 
 template<PointOrigin PO, Quantity Q>
   requires ReferenceOf<std::remove_const_t<decltype(Q::reference)>, PO::quantity_spec>
-[[nodiscard]] constexpr quantity_point<Q::reference, PO{}, typename Q::rep> operator+(PO, Q&& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity_point<Q::reference, PO{}, typename Q::rep> operator+(PO, Q&& q)
 {
-  return make_quantity_point<PO{}>(std::forward<Q>(q));
+  return make_quantity_point<PO{}>(MP_UNITS_FWD(q));
 }
 
 template<Quantity Q, PointOrigin PO>
   requires ReferenceOf<std::remove_const_t<decltype(Q::reference)>, PO::quantity_spec>
-[[nodiscard]] constexpr quantity_point<Q::reference, PO{}, typename Q::rep> operator+(Q&& q, PO po)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity_point<Q::reference, PO{}, typename Q::rep>
+operator+(Q&& q, PO po)
 {
-  return po + std::forward<Q>(q);
+  return po + MP_UNITS_FWD(q);
 }
 
 template<auto R1, auto PO1, typename Rep1, auto R2, typename Rep2>
 // TODO simplify when gcc catches up
   requires ReferenceOf<std::remove_const_t<decltype(R2)>, PO1.quantity_spec>
-[[nodiscard]] constexpr QuantityPoint auto operator-(const quantity_point<R1, PO1, Rep1>& qp,
-                                                     const quantity<R2, Rep2>& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr QuantityPoint auto operator-(const quantity_point<R1, PO1, Rep1>& qp,
+                                                                            const quantity<R2, Rep2>& q)
   requires requires { qp.quantity_from_origin() - q; }
 {
   return make_quantity_point<PO1>(qp.quantity_from_origin() - q);
@@ -276,14 +333,14 @@ template<auto R1, auto PO1, typename Rep1, auto R2, typename Rep2>
 
 template<PointOrigin PO, Quantity Q>
   requires ReferenceOf<std::remove_const_t<decltype(Q::reference)>, PO::quantity_spec>
-[[nodiscard]] constexpr QuantityPoint auto operator-(PO po, const Q& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr QuantityPoint auto operator-(PO po, const Q& q)
   requires requires { -q; }
 {
   return po + (-q);
 }
 
 template<QuantityPoint QP1, QuantityPointOf<QP1::absolute_point_origin> QP2>
-[[nodiscard]] constexpr Quantity auto operator-(const QP1& lhs, const QP2& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator-(const QP1& lhs, const QP2& rhs)
   // TODO consider constraining it for both branches
   requires requires { lhs.quantity_from_origin() - rhs.quantity_from_origin(); }
 {
@@ -294,31 +351,47 @@ template<QuantityPoint QP1, QuantityPointOf<QP1::absolute_point_origin> QP2>
     return lhs.quantity_from_origin() - rhs.quantity_from_origin() + (lhs.point_origin - rhs.point_origin);
 }
 
+namespace detail {
+
+// the quantity of `qp` relative to `po` calculated by adding the origins' offsets step by step
+template<PointOrigin PO, QuantityPoint QP>
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto quantity_from_origin_steps(const QP& qp, PO po)
+{
+  if constexpr (detail::is_derived_from_specialization_of_absolute_point_origin<PO>)
+    return qp.quantity_from_origin() + (qp.point_origin - qp.absolute_point_origin);
+  else if constexpr (is_same_v<std::remove_const_t<decltype(QP::point_origin)>,
+                               std::remove_const_t<decltype(po.quantity_point.point_origin)>>)
+    return qp.quantity_from_origin() - po.quantity_point.quantity_from_origin();
+  else
+    return qp.quantity_from_origin() - po.quantity_point.quantity_from_origin() +
+           (qp.point_origin - po.quantity_point.point_origin);
+}
+
+}  // namespace detail
+
 template<PointOrigin PO, QuantityPointOf<PO{}> QP>
   requires ReferenceOf<std::remove_const_t<decltype(QP::reference)>, PO::quantity_spec>
-[[nodiscard]] constexpr Quantity auto operator-(const QP& qp, PO po)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator-(const QP& qp, PO po)
 {
-  if constexpr (is_same_v<std::remove_const_t<decltype(QP::point_origin)>, std::remove_const_t<PO>>)
+  if constexpr (is_same_v<std::remove_const_t<decltype(QP::point_origin)>, std::remove_const_t<PO>> ||
+                (detail::is_derived_from_specialization_of_absolute_point_origin<PO> &&
+                 is_same_v<std::remove_const_t<decltype(QP::point_origin)>,
+                           std::remove_const_t<decltype(QP::absolute_point_origin)>>))
     return qp.quantity_from_origin();
-  else if constexpr (detail::is_derived_from_specialization_of_absolute_point_origin<PO>) {
-    if constexpr (is_same_v<std::remove_const_t<decltype(QP::point_origin)>,
-                            std::remove_const_t<decltype(QP::absolute_point_origin)>>)
-      return qp.quantity_from_origin();
-    else
-      return qp.quantity_from_origin() + (qp.point_origin - qp.absolute_point_origin);
-  } else {
-    if constexpr (is_same_v<std::remove_const_t<decltype(QP::point_origin)>,
-                            std::remove_const_t<decltype(po.quantity_point.point_origin)>>)
-      return qp.quantity_from_origin() - po.quantity_point.quantity_from_origin();
-    else
-      return qp.quantity_from_origin() - po.quantity_point.quantity_from_origin() +
-             (qp.point_origin - po.quantity_point.point_origin);
+  else {
+    using ret = decltype(detail::quantity_from_origin_steps(qp, po));
+    if constexpr (detail::FusablePointConversion<typename QP::rep, typename ret::rep>) {
+      // the offset of origins and the change of a unit applied in one step
+      using map = detail::point_affine_map<QP::unit, QP::point_origin, ret::unit, PO{}, typename ret::rep>;
+      return make_quantity<ret::reference>(map::apply(qp.quantity_from_origin().numerical_value()));
+    } else
+      return detail::quantity_from_origin_steps(qp, po);
   }
 }
 
 template<PointOrigin PO, QuantityPointOf<PO{}> QP>
   requires ReferenceOf<std::remove_const_t<decltype(QP::reference)>, PO::quantity_spec>
-[[nodiscard]] constexpr Quantity auto operator-(PO po, const QP& qp)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator-(PO po, const QP& qp)
 {
   return -(qp - po);
 }
@@ -327,7 +400,7 @@ template<PointOrigin PO1, detail::SameAbsolutePointOriginAs<PO1{}> PO2>
   requires QuantitySpecOf<std::remove_const_t<decltype(PO1::quantity_spec)>, PO2::quantity_spec> &&
            (detail::is_derived_from_specialization_of_relative_point_origin<PO1> ||
             detail::is_derived_from_specialization_of_relative_point_origin<PO2>)
-[[nodiscard]] constexpr Quantity auto operator-(PO1 po1, PO2 po2)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr Quantity auto operator-(PO1 po1, PO2 po2)
 {
   if constexpr (detail::is_derived_from_specialization_of_absolute_point_origin<PO1>) {
     return -(po2.quantity_point - po2.quantity_point.absolute_point_origin);
@@ -340,7 +413,7 @@ template<PointOrigin PO1, detail::SameAbsolutePointOriginAs<PO1{}> PO2>
 
 template<QuantityPoint QP1, QuantityPointOf<QP1::absolute_point_origin> QP2>
   requires std::three_way_comparable_with<typename QP1::quantity_type, typename QP2::quantity_type>
-[[nodiscard]] constexpr auto operator<=>(const QP1& lhs, const QP2& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr auto operator<=>(const QP1& lhs, const QP2& rhs)
 {
   if constexpr (is_same_v<std::remove_const_t<decltype(QP1::point_origin)>,
                           std::remove_const_t<decltype(QP2::point_origin)>>)
@@ -351,7 +424,7 @@ template<QuantityPoint QP1, QuantityPointOf<QP1::absolute_point_origin> QP2>
 
 template<QuantityPoint QP1, QuantityPointOf<QP1::absolute_point_origin> QP2>
   requires std::equality_comparable_with<typename QP1::quantity_type, typename QP2::quantity_type>
-[[nodiscard]] constexpr bool operator==(const QP1& lhs, const QP2& rhs)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr bool operator==(const QP1& lhs, const QP2& rhs)
 {
   if constexpr (is_same_v<std::remove_const_t<decltype(QP1::point_origin)>,
                           std::remove_const_t<decltype(QP2::point_origin)>>)
@@ -367,9 +440,28 @@ template<auto PO, typename Q>
 template<PointOrigin auto PO, Quantity Q>
   requires ReferenceOf<std::remove_const_t<decltype(Q::reference)>, PO.quantity_spec>
 #endif
-[[nodiscard]] constexpr quantity_point<Q::reference, PO, typename Q::rep> make_quantity_point(Q&& q)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity_point<Q::reference, PO, typename Q::rep>
+make_quantity_point(Q&& q)
+{
+  return quantity_point<Q::reference, PO, typename Q::rep>(MP_UNITS_FWD(q));
+}
+
+/**
+ * @brief Converts a sequence of quantity points to another unit and/or point origin
+ *
+ * Every element is converted with the converting constructor of `ToQP`. For floating-point
+ * representation types it applies a single multiply-add with factors computed at compile time,
+ * so the loop can be vectorized by the compiler.
+ *
+ * @tparam ToQP a quantity point type to convert to
+ * @return an iterator past the last written element
+ */
+template<QuantityPoint ToQP, std::input_iterator It, std::sentinel_for<It> S, typename Out>
+  requires QuantityPoint<std::iter_value_t<It>> && std::constructible_from<ToQP, std::iter_value_t<It>>
+constexpr Out convert_points(It first, S last, Out out)
 {
-  return quantity_point<Q::reference, PO, typename Q::rep>(std::forward<Q>(q));
+  for (; first != last; ++first, (void)++out) *out = ToQP(*first);
+  return out;
 }
 
 }  // namespace mp_units
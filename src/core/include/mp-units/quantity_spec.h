@@ -50,12 +50,32 @@ template<std::same_as<quantity_character>... Ts>
   return max({args...});
 }
 
+/**
+ * @brief Returns the character of the numerator of a derived quantity
+ *
+ * The same as `common_quantity_character()` except that a product of exactly one tensor and one vector
+ * factor (both in the first power) returns a vector. The ISQ uses such a product only as a contraction
+ * (e.g. `moment_of_inertia * angular_velocity` is an `angular_momentum`).
+ */
+template<typename... Qs>
+[[nodiscard]] consteval quantity_character product_quantity_character()
+{
+  constexpr int tensors = (0 + ... + (expr_type<Qs>::character == quantity_character::tensor ? 1 : 0));
+  constexpr int vectors = (0 + ... + (expr_type<Qs>::character == quantity_character::vector ? 1 : 0));
+  constexpr bool single_contraction =
+    tensors == 1 && vectors == 1 &&
+    (... && (expr_type<Qs>::character == quantity_character::scalar || !is_specialization_of_power<Qs>));
+  if constexpr (single_contraction)
+    return quantity_character::vector;
+  else
+    return common_quantity_character(quantity_character::scalar, expr_type<Qs>::character...);
+}
+
 template<typename... Qs1, typename... Qs2>
 [[nodiscard]] consteval quantity_character derived_quantity_character(const type_list<Qs1...>&,
                                                                       const type_list<Qs2...>&)
 {
-  constexpr quantity_character num =
-    common_quantity_character(quantity_character::scalar, expr_type<Qs1>::character...);
+  constexpr quantity_character num = product_quantity_character<Qs1...>();
   constexpr quantity_character den =
     common_quantity_character(quantity_character::scalar, expr_type<Qs2>::character...);
   if constexpr (num == den)
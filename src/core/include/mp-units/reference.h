@@ -159,9 +159,9 @@ template<Reference auto R, RepresentationOf<get_quantity_spec(R).character> Rep>
 class quantity;
 
 template<typename Rep, Reference R>
-[[nodiscard]] constexpr quantity<R{}, std::remove_cvref_t<Rep>> operator*(Rep&& lhs, R)
+[[nodiscard]] MP_UNITS_ALWAYS_INLINE constexpr quantity<R{}, std::remove_cvref_t<Rep>> operator*(Rep&& lhs, R)
 {
-  return make_quantity<R{}>(std::forward<Rep>(lhs));
+  return make_quantity<R{}>(MP_UNITS_FWD(lhs));
 }
 
 void /*Use `q * (1 * r)` rather than `q * r`.*/ operator*(Quantity auto, Reference auto) = delete;
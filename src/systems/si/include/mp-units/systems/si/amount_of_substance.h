@@ -0,0 +1,86 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qmol = quecto<mole>;
+inline constexpr auto rmol = ronto<mole>;
+inline constexpr auto ymol = yocto<mole>;
+inline constexpr auto zmol = zepto<mole>;
+inline constexpr auto amol = atto<mole>;
+inline constexpr auto fmol = femto<mole>;
+inline constexpr auto pmol = pico<mole>;
+inline constexpr auto nmol = nano<mole>;
+inline constexpr auto umol = micro<mole>;
+inline constexpr auto mmol = milli<mole>;
+inline constexpr auto cmol = centi<mole>;
+inline constexpr auto dmol = deci<mole>;
+inline constexpr auto mol = mole;
+inline constexpr auto damol = deca<mole>;
+inline constexpr auto hmol = hecto<mole>;
+inline constexpr auto kmol = kilo<mole>;
+inline constexpr auto Mmol = mega<mole>;
+inline constexpr auto Gmol = giga<mole>;
+inline constexpr auto Tmol = tera<mole>;
+inline constexpr auto Pmol = peta<mole>;
+inline constexpr auto Emol = exa<mole>;
+inline constexpr auto Zmol = zetta<mole>;
+inline constexpr auto Ymol = yotta<mole>;
+inline constexpr auto Rmol = ronna<mole>;
+inline constexpr auto Qmol = quetta<mole>;
+
+inline constexpr auto qkat = quecto<katal>;
+inline constexpr auto rkat = ronto<katal>;
+inline constexpr auto ykat = yocto<katal>;
+inline constexpr auto zkat = zepto<katal>;
+inline constexpr auto akat = atto<katal>;
+inline constexpr auto fkat = femto<katal>;
+inline constexpr auto pkat = pico<katal>;
+inline constexpr auto nkat = nano<katal>;
+inline constexpr auto ukat = micro<katal>;
+inline constexpr auto mkat = milli<katal>;
+inline constexpr auto ckat = centi<katal>;
+inline constexpr auto dkat = deci<katal>;
+inline constexpr auto kat = katal;
+inline constexpr auto dakat = deca<katal>;
+inline constexpr auto hkat = hecto<katal>;
+inline constexpr auto kkat = kilo<katal>;
+inline constexpr auto Mkat = mega<katal>;
+inline constexpr auto Gkat = giga<katal>;
+inline constexpr auto Tkat = tera<katal>;
+inline constexpr auto Pkat = peta<katal>;
+inline constexpr auto Ekat = exa<katal>;
+inline constexpr auto Zkat = zetta<katal>;
+inline constexpr auto Ykat = yotta<katal>;
+inline constexpr auto Rkat = ronna<katal>;
+inline constexpr auto Qkat = quetta<katal>;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
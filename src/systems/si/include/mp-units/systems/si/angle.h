@@ -0,0 +1,101 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qrad = quecto<radian>;
+inline constexpr auto rrad = ronto<radian>;
+inline constexpr auto yrad = yocto<radian>;
+inline constexpr auto zrad = zepto<radian>;
+inline constexpr auto arad = atto<radian>;
+inline constexpr auto frad = femto<radian>;
+inline constexpr auto prad = pico<radian>;
+inline constexpr auto nrad = nano<radian>;
+inline constexpr auto urad = micro<radian>;
+inline constexpr auto mrad = milli<radian>;
+inline constexpr auto crad = centi<radian>;
+inline constexpr auto drad = deci<radian>;
+inline constexpr auto rad = radian;
+inline constexpr auto darad = deca<radian>;
+inline constexpr auto hrad = hecto<radian>;
+inline constexpr auto krad = kilo<radian>;
+inline constexpr auto Mrad = mega<radian>;
+inline constexpr auto Grad = giga<radian>;
+inline constexpr auto Trad = tera<radian>;
+inline constexpr auto Prad = peta<radian>;
+inline constexpr auto Erad = exa<radian>;
+inline constexpr auto Zrad = zetta<radian>;
+inline constexpr auto Yrad = yotta<radian>;
+inline constexpr auto Rrad = ronna<radian>;
+inline constexpr auto Qrad = quetta<radian>;
+
+inline constexpr auto qsr = quecto<steradian>;
+inline constexpr auto rsr = ronto<steradian>;
+inline constexpr auto ysr = yocto<steradian>;
+inline constexpr auto zsr = zepto<steradian>;
+inline constexpr auto asr = atto<steradian>;
+inline constexpr auto fsr = femto<steradian>;
+inline constexpr auto psr = pico<steradian>;
+inline constexpr auto nsr = nano<steradian>;
+inline constexpr auto usr = micro<steradian>;
+inline constexpr auto msr = milli<steradian>;
+inline constexpr auto csr = centi<steradian>;
+inline constexpr auto dsr = deci<steradian>;
+inline constexpr auto sr = steradian;
+inline constexpr auto dasr = deca<steradian>;
+inline constexpr auto hsr = hecto<steradian>;
+inline constexpr auto ksr = kilo<steradian>;
+inline constexpr auto Msr = mega<steradian>;
+inline constexpr auto Gsr = giga<steradian>;
+inline constexpr auto Tsr = tera<steradian>;
+inline constexpr auto Psr = peta<steradian>;
+inline constexpr auto Esr = exa<steradian>;
+inline constexpr auto Zsr = zetta<steradian>;
+inline constexpr auto Ysr = yotta<steradian>;
+inline constexpr auto Rsr = ronna<steradian>;
+inline constexpr auto Qsr = quetta<steradian>;
+
+}  // namespace si::unit_symbols
+
+namespace non_si::unit_symbols {
+
+// TODO Should the following non-SI units have prefixed symbols predefiend as well?
+inline constexpr auto deg = degree;
+inline constexpr auto arcmin = arcminute;
+inline constexpr auto arcsec = arcsecond;
+
+}  // namespace non_si::unit_symbols
+
+namespace si::unit_symbols {
+
+using namespace non_si::unit_symbols;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
@@ -0,0 +1,60 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qA = quecto<ampere>;
+inline constexpr auto rA = ronto<ampere>;
+inline constexpr auto yA = yocto<ampere>;
+inline constexpr auto zA = zepto<ampere>;
+inline constexpr auto aA = atto<ampere>;
+inline constexpr auto fA = femto<ampere>;
+inline constexpr auto pA = pico<ampere>;
+inline constexpr auto nA = nano<ampere>;
+inline constexpr auto uA = micro<ampere>;
+inline constexpr auto mA = milli<ampere>;
+inline constexpr auto cA = centi<ampere>;
+inline constexpr auto dA = deci<ampere>;
+inline constexpr auto A = ampere;
+inline constexpr auto daA = deca<ampere>;
+inline constexpr auto hA = hecto<ampere>;
+inline constexpr auto kA = kilo<ampere>;
+inline constexpr auto MA = mega<ampere>;
+inline constexpr auto GA = giga<ampere>;
+inline constexpr auto TA = tera<ampere>;
+inline constexpr auto PA = peta<ampere>;
+inline constexpr auto EA = exa<ampere>;
+inline constexpr auto ZA = zetta<ampere>;
+inline constexpr auto YA = yotta<ampere>;
+inline constexpr auto RA = ronna<ampere>;
+inline constexpr auto QA = quetta<ampere>;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
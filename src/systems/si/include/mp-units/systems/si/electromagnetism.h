@@ -0,0 +1,216 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qC = quecto<coulomb>;
+inline constexpr auto rC = ronto<coulomb>;
+inline constexpr auto yC = yocto<coulomb>;
+inline constexpr auto zC = zepto<coulomb>;
+inline constexpr auto aC = atto<coulomb>;
+inline constexpr auto fC = femto<coulomb>;
+inline constexpr auto pC = pico<coulomb>;
+inline constexpr auto nC = nano<coulomb>;
+inline constexpr auto uC = micro<coulomb>;
+inline constexpr auto mC = milli<coulomb>;
+inline constexpr auto cC = centi<coulomb>;
+inline constexpr auto dC = deci<coulomb>;
+inline constexpr auto C = coulomb;
+inline constexpr auto daC = deca<coulomb>;
+inline constexpr auto hC = hecto<coulomb>;
+inline constexpr auto kC = kilo<coulomb>;
+inline constexpr auto MC = mega<coulomb>;
+inline constexpr auto GC = giga<coulomb>;
+inline constexpr auto TC = tera<coulomb>;
+inline constexpr auto PC = peta<coulomb>;
+inline constexpr auto EC = exa<coulomb>;
+inline constexpr auto ZC = zetta<coulomb>;
+inline constexpr auto YC = yotta<coulomb>;
+inline constexpr auto RC = ronna<coulomb>;
+inline constexpr auto QC = quetta<coulomb>;
+
+inline constexpr auto qV = quecto<volt>;
+inline constexpr auto rV = ronto<volt>;
+inline constexpr auto yV = yocto<volt>;
+inline constexpr auto zV = zepto<volt>;
+inline constexpr auto aV = atto<volt>;
+inline constexpr auto fV = femto<volt>;
+inline constexpr auto pV = pico<volt>;
+inline constexpr auto nV = nano<volt>;
+inline constexpr auto uV = micro<volt>;
+inline constexpr auto mV = milli<volt>;
+inline constexpr auto cV = centi<volt>;
+inline constexpr auto dV = deci<volt>;
+inline constexpr auto V = volt;
+inline constexpr auto daV = deca<volt>;
+inline constexpr auto hV = hecto<volt>;
+inline constexpr auto kV = kilo<volt>;
+inline constexpr auto MV = mega<volt>;
+inline constexpr auto GV = giga<volt>;
+inline constexpr auto TV = tera<volt>;
+inline constexpr auto PV = peta<volt>;
+inline constexpr auto EV = exa<volt>;
+inline constexpr auto ZV = zetta<volt>;
+inline constexpr auto YV = yotta<volt>;
+inline constexpr auto RV = ronna<volt>;
+inline constexpr auto QV = quetta<volt>;
+
+inline constexpr auto qF = quecto<farad>;
+inline constexpr auto rF = ronto<farad>;
+inline constexpr auto yF = yocto<farad>;
+inline constexpr auto zF = zepto<farad>;
+inline constexpr auto aF = atto<farad>;
+inline constexpr auto fF = femto<farad>;
+inline constexpr auto pF = pico<farad>;
+inline constexpr auto nF = nano<farad>;
+inline constexpr auto uF = micro<farad>;
+inline constexpr auto mF = milli<farad>;
+inline constexpr auto cF = centi<farad>;
+inline constexpr auto dF = deci<farad>;
+inline constexpr auto F = farad;
+inline constexpr auto daF = deca<farad>;
+inline constexpr auto hF = hecto<farad>;
+inline constexpr auto kF = kilo<farad>;
+inline constexpr auto MF = mega<farad>;
+inline constexpr auto GF = giga<farad>;
+inline constexpr auto TF = tera<farad>;
+inline constexpr auto PF = peta<farad>;
+inline constexpr auto EF = exa<farad>;
+inline constexpr auto ZF = zetta<farad>;
+inline constexpr auto YF = yotta<farad>;
+inline constexpr auto RF = ronna<farad>;
+inline constexpr auto QF = quetta<farad>;
+
+inline constexpr auto qS = quecto<siemens>;
+inline constexpr auto rS = ronto<siemens>;
+inline constexpr auto yS = yocto<siemens>;
+inline constexpr auto zS = zepto<siemens>;
+inline constexpr auto aS = atto<siemens>;
+inline constexpr auto fS = femto<siemens>;
+inline constexpr auto pS = pico<siemens>;
+inline constexpr auto nS = nano<siemens>;
+inline constexpr auto uS = micro<siemens>;
+inline constexpr auto mS = milli<siemens>;
+inline constexpr auto cS = centi<siemens>;
+inline constexpr auto dS = deci<siemens>;
+inline constexpr auto S = siemens;
+inline constexpr auto daS = deca<siemens>;
+inline constexpr auto hS = hecto<siemens>;
+inline constexpr auto kS = kilo<siemens>;
+inline constexpr auto MS = mega<siemens>;
+inline constexpr auto GS = giga<siemens>;
+inline constexpr auto TS = tera<siemens>;
+inline constexpr auto PS = peta<siemens>;
+inline constexpr auto ES = exa<siemens>;
+inline constexpr auto ZS = zetta<siemens>;
+inline constexpr auto YS = yotta<siemens>;
+inline constexpr auto RS = ronna<siemens>;
+inline constexpr auto QS = quetta<siemens>;
+
+inline constexpr auto qWb = quecto<weber>;
+inline constexpr auto rWb = ronto<weber>;
+inline constexpr auto yWb = yocto<weber>;
+inline constexpr auto zWb = zepto<weber>;
+inline constexpr auto aWb = atto<weber>;
+inline constexpr auto fWb = femto<weber>;
+inline constexpr auto pWb = pico<weber>;
+inline constexpr auto nWb = nano<weber>;
+inline constexpr auto uWb = micro<weber>;
+inline constexpr auto mWb = milli<weber>;
+inline constexpr auto cWb = centi<weber>;
+inline constexpr auto dWb = deci<weber>;
+inline constexpr auto Wb = weber;
+inline constexpr auto daWb = deca<weber>;
+inline constexpr auto hWb = hecto<weber>;
+inline constexpr auto kWb = kilo<weber>;
+inline constexpr auto MWb = mega<weber>;
+inline constexpr auto GWb = giga<weber>;
+inline constexpr auto TWb = tera<weber>;
+inline constexpr auto PWb = peta<weber>;
+inline constexpr auto EWb = exa<weber>;
+inline constexpr auto ZWb = zetta<weber>;
+inline constexpr auto YWb = yotta<weber>;
+inline constexpr auto RWb = ronna<weber>;
+inline constexpr auto QWb = quetta<weber>;
+
+inline constexpr auto qT = quecto<tesla>;
+inline constexpr auto rT = ronto<tesla>;
+inline constexpr auto yT = yocto<tesla>;
+inline constexpr auto zT = zepto<tesla>;
+inline constexpr auto aT = atto<tesla>;
+inline constexpr auto fT = femto<tesla>;
+inline constexpr auto pT = pico<tesla>;
+inline constexpr auto nT = nano<tesla>;
+inline constexpr auto uT = micro<tesla>;
+inline constexpr auto mT = milli<tesla>;
+inline constexpr auto cT = centi<tesla>;
+inline constexpr auto dT = deci<tesla>;
+inline constexpr auto T = tesla;
+inline constexpr auto daT = deca<tesla>;
+inline constexpr auto hT = hecto<tesla>;
+inline constexpr auto kT = kilo<tesla>;
+inline constexpr auto MT = mega<tesla>;
+inline constexpr auto GT = giga<tesla>;
+inline constexpr auto TT = tera<tesla>;
+inline constexpr auto PT = peta<tesla>;
+inline constexpr auto ET = exa<tesla>;
+inline constexpr auto ZT = zetta<tesla>;
+inline constexpr auto YT = yotta<tesla>;
+inline constexpr auto RT = ronna<tesla>;
+inline constexpr auto QT = quetta<tesla>;
+
+inline constexpr auto qH = quecto<henry>;
+inline constexpr auto rH = ronto<henry>;
+inline constexpr auto yH = yocto<henry>;
+inline constexpr auto zH = zepto<henry>;
+inline constexpr auto aH = atto<henry>;
+inline constexpr auto fH = femto<henry>;
+inline constexpr auto pH = pico<henry>;
+inline constexpr auto nH = nano<henry>;
+inline constexpr auto uH = micro<henry>;
+inline constexpr auto mH = milli<henry>;
+inline constexpr auto cH = centi<henry>;
+inline constexpr auto dH = deci<henry>;
+inline constexpr auto H = henry;
+inline constexpr auto daH = deca<henry>;
+inline constexpr auto hH = hecto<henry>;
+inline constexpr auto kH = kilo<henry>;
+inline constexpr auto MH = mega<henry>;
+inline constexpr auto GH = giga<henry>;
+inline constexpr auto TH = tera<henry>;
+inline constexpr auto PH = peta<henry>;
+inline constexpr auto EH = exa<henry>;
+inline constexpr auto ZH = zetta<henry>;
+inline constexpr auto YH = yotta<henry>;
+inline constexpr auto RH = ronna<henry>;
+inline constexpr auto QH = quetta<henry>;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
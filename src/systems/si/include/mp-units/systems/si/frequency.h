@@ -0,0 +1,60 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qHz = quecto<hertz>;
+inline constexpr auto rHz = ronto<hertz>;
+inline constexpr auto yHz = yocto<hertz>;
+inline constexpr auto zHz = zepto<hertz>;
+inline constexpr auto aHz = atto<hertz>;
+inline constexpr auto fHz = femto<hertz>;
+inline constexpr auto pHz = pico<hertz>;
+inline constexpr auto nHz = nano<hertz>;
+inline constexpr auto uHz = micro<hertz>;
+inline constexpr auto mHz = milli<hertz>;
+inline constexpr auto cHz = centi<hertz>;
+inline constexpr auto dHz = deci<hertz>;
+inline constexpr auto Hz = hertz;
+inline constexpr auto daHz = deca<hertz>;
+inline constexpr auto hHz = hecto<hertz>;
+inline constexpr auto kHz = kilo<hertz>;
+inline constexpr auto MHz = mega<hertz>;
+inline constexpr auto GHz = giga<hertz>;
+inline constexpr auto THz = tera<hertz>;
+inline constexpr auto PHz = peta<hertz>;
+inline constexpr auto EHz = exa<hertz>;
+inline constexpr auto ZHz = zetta<hertz>;
+inline constexpr auto YHz = yotta<hertz>;
+inline constexpr auto RHz = ronna<hertz>;
+inline constexpr auto QHz = quetta<hertz>;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
@@ -0,0 +1,112 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qBq = quecto<becquerel>;
+inline constexpr auto rBq = ronto<becquerel>;
+inline constexpr auto yBq = yocto<becquerel>;
+inline constexpr auto zBq = zepto<becquerel>;
+inline constexpr auto aBq = atto<becquerel>;
+inline constexpr auto fBq = femto<becquerel>;
+inline constexpr auto pBq = pico<becquerel>;
+inline constexpr auto nBq = nano<becquerel>;
+inline constexpr auto uBq = micro<becquerel>;
+inline constexpr auto mBq = milli<becquerel>;
+inline constexpr auto cBq = centi<becquerel>;
+inline constexpr auto dBq = deci<becquerel>;
+inline constexpr auto Bq = becquerel;
+inline constexpr auto daBq = deca<becquerel>;
+inline constexpr auto hBq = hecto<becquerel>;
+inline constexpr auto kBq = kilo<becquerel>;
+inline constexpr auto MBq = mega<becquerel>;
+inline constexpr auto GBq = giga<becquerel>;
+inline constexpr auto TBq = tera<becquerel>;
+inline constexpr auto PBq = peta<becquerel>;
+inline constexpr auto EBq = exa<becquerel>;
+inline constexpr auto ZBq = zetta<becquerel>;
+inline constexpr auto YBq = yotta<becquerel>;
+inline constexpr auto RBq = ronna<becquerel>;
+inline constexpr auto QBq = quetta<becquerel>;
+
+inline constexpr auto qGy = quecto<gray>;
+inline constexpr auto rGy = ronto<gray>;
+inline constexpr auto yGy = yocto<gray>;
+inline constexpr auto zGy = zepto<gray>;
+inline constexpr auto aGy = atto<gray>;
+inline constexpr auto fGy = femto<gray>;
+inline constexpr auto pGy = pico<gray>;
+inline constexpr auto nGy = nano<gray>;
+inline constexpr auto uGy = micro<gray>;
+inline constexpr auto mGy = milli<gray>;
+inline constexpr auto cGy = centi<gray>;
+inline constexpr auto dGy = deci<gray>;
+inline constexpr auto Gy = gray;
+inline constexpr auto daGy = deca<gray>;
+inline constexpr auto hGy = hecto<gray>;
+inline constexpr auto kGy = kilo<gray>;
+inline constexpr auto MGy = mega<gray>;
+inline constexpr auto GGy = giga<gray>;
+inline constexpr auto TGy = tera<gray>;
+inline constexpr auto PGy = peta<gray>;
+inline constexpr auto EGy = exa<gray>;
+inline constexpr auto ZGy = zetta<gray>;
+inline constexpr auto YGy = yotta<gray>;
+inline constexpr auto RGy = ronna<gray>;
+inline constexpr auto QGy = quetta<gray>;
+
+inline constexpr auto qSv = quecto<sievert>;
+inline constexpr auto rSv = ronto<sievert>;
+inline constexpr auto ySv = yocto<sievert>;
+inline constexpr auto zSv = zepto<sievert>;
+inline constexpr auto aSv = atto<sievert>;
+inline constexpr auto fSv = femto<sievert>;
+inline constexpr auto pSv = pico<sievert>;
+inline constexpr auto nSv = nano<sievert>;
+inline constexpr auto uSv = micro<sievert>;
+inline constexpr auto mSv = milli<sievert>;
+inline constexpr auto cSv = centi<sievert>;
+inline constexpr auto dSv = deci<sievert>;
+inline constexpr auto Sv = sievert;
+inline constexpr auto daSv = deca<sievert>;
+inline constexpr auto hSv = hecto<sievert>;
+inline constexpr auto kSv = kilo<sievert>;
+inline constexpr auto MSv = mega<sievert>;
+inline constexpr auto GSv = giga<sievert>;
+inline constexpr auto TSv = tera<sievert>;
+inline constexpr auto PSv = peta<sievert>;
+inline constexpr auto ESv = exa<sievert>;
+inline constexpr auto ZSv = zetta<sievert>;
+inline constexpr auto YSv = yotta<sievert>;
+inline constexpr auto RSv = ronna<sievert>;
+inline constexpr auto QSv = quetta<sievert>;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
@@ -0,0 +1,81 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qm = quecto<metre>;
+inline constexpr auto rm = ronto<metre>;
+inline constexpr auto ym = yocto<metre>;
+inline constexpr auto zm = zepto<metre>;
+inline constexpr auto am = atto<metre>;
+inline constexpr auto fm = femto<metre>;
+inline constexpr auto pm = pico<metre>;
+inline constexpr auto nm = nano<metre>;
+inline constexpr auto um = micro<metre>;
+inline constexpr auto mm = milli<metre>;
+inline constexpr auto cm = centi<metre>;
+inline constexpr auto dm = deci<metre>;
+inline constexpr auto m = metre;
+inline constexpr auto dam = deca<metre>;
+inline constexpr auto hm = hecto<metre>;
+inline constexpr auto km = kilo<metre>;
+inline constexpr auto Mm = mega<metre>;
+inline constexpr auto Gm = giga<metre>;
+inline constexpr auto Tm = tera<metre>;
+inline constexpr auto Pm = peta<metre>;
+inline constexpr auto Em = exa<metre>;
+inline constexpr auto Zm = zetta<metre>;
+inline constexpr auto Ym = yotta<metre>;
+inline constexpr auto Rm = ronna<metre>;
+inline constexpr auto Qm = quetta<metre>;
+
+// commonly used squared and cubic units
+inline constexpr auto m2 = square(metre);
+inline constexpr auto m3 = cubic(metre);
+inline constexpr auto m4 = pow<4>(metre);
+
+}  // namespace si::unit_symbols
+
+namespace non_si::unit_symbols {
+
+// TODO Should the following non-SI units have prefixed symbols predefiend as well?
+inline constexpr auto au = astronomical_unit;
+inline constexpr auto a = are;
+inline constexpr auto ha = hectare;
+inline constexpr auto l = litre;
+
+}  // namespace non_si::unit_symbols
+
+namespace si::unit_symbols {
+
+using namespace non_si::unit_symbols;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
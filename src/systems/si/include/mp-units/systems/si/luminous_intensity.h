@@ -0,0 +1,112 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qcd = quecto<candela>;
+inline constexpr auto rcd = ronto<candela>;
+inline constexpr auto ycd = yocto<candela>;
+inline constexpr auto zcd = zepto<candela>;
+inline constexpr auto acd = atto<candela>;
+inline constexpr auto fcd = femto<candela>;
+inline constexpr auto pcd = pico<candela>;
+inline constexpr auto ncd = nano<candela>;
+inline constexpr auto ucd = micro<candela>;
+inline constexpr auto mcd = milli<candela>;
+inline constexpr auto ccd = centi<candela>;
+inline constexpr auto dcd = deci<candela>;
+inline constexpr auto cd = candela;
+inline constexpr auto dacd = deca<candela>;
+inline constexpr auto hcd = hecto<candela>;
+inline constexpr auto kcd = kilo<candela>;
+inline constexpr auto Mcd = mega<candela>;
+inline constexpr auto Gcd = giga<candela>;
+inline constexpr auto Tcd = tera<candela>;
+inline constexpr auto Pcd = peta<candela>;
+inline constexpr auto Ecd = exa<candela>;
+inline constexpr auto Zcd = zetta<candela>;
+inline constexpr auto Ycd = yotta<candela>;
+inline constexpr auto Rcd = ronna<candela>;
+inline constexpr auto Qcd = quetta<candela>;
+
+inline constexpr auto qlm = quecto<lumen>;
+inline constexpr auto rlm = ronto<lumen>;
+inline constexpr auto ylm = yocto<lumen>;
+inline constexpr auto zlm = zepto<lumen>;
+inline constexpr auto alm = atto<lumen>;
+inline constexpr auto flm = femto<lumen>;
+inline constexpr auto plm = pico<lumen>;
+inline constexpr auto nlm = nano<lumen>;
+inline constexpr auto ulm = micro<lumen>;
+inline constexpr auto mlm = milli<lumen>;
+inline constexpr auto clm = centi<lumen>;
+inline constexpr auto dlm = deci<lumen>;
+inline constexpr auto lm = lumen;
+inline constexpr auto dalm = deca<lumen>;
+inline constexpr auto hlm = hecto<lumen>;
+inline constexpr auto klm = kilo<lumen>;
+inline constexpr auto Mlm = mega<lumen>;
+inline constexpr auto Glm = giga<lumen>;
+inline constexpr auto Tlm = tera<lumen>;
+inline constexpr auto Plm = peta<lumen>;
+inline constexpr auto Elm = exa<lumen>;
+inline constexpr auto Zlm = zetta<lumen>;
+inline constexpr auto Ylm = yotta<lumen>;
+inline constexpr auto Rlm = ronna<lumen>;
+inline constexpr auto Qlm = quetta<lumen>;
+
+inline constexpr auto qlx = quecto<lux>;
+inline constexpr auto rlx = ronto<lux>;
+inline constexpr auto ylx = yocto<lux>;
+inline constexpr auto zlx = zepto<lux>;
+inline constexpr auto alx = atto<lux>;
+inline constexpr auto flx = femto<lux>;
+inline constexpr auto plx = pico<lux>;
+inline constexpr auto nlx = nano<lux>;
+inline constexpr auto ulx = micro<lux>;
+inline constexpr auto mlx = milli<lux>;
+inline constexpr auto clx = centi<lux>;
+inline constexpr auto dlx = deci<lux>;
+inline constexpr auto lx = lux;
+inline constexpr auto dalx = deca<lux>;
+inline constexpr auto hlx = hecto<lux>;
+inline constexpr auto klx = kilo<lux>;
+inline constexpr auto Mlx = mega<lux>;
+inline constexpr auto Glx = giga<lux>;
+inline constexpr auto Tlx = tera<lux>;
+inline constexpr auto Plx = peta<lux>;
+inline constexpr auto Elx = exa<lux>;
+inline constexpr auto Zlx = zetta<lux>;
+inline constexpr auto Ylx = yotta<lux>;
+inline constexpr auto Rlx = ronna<lux>;
+inline constexpr auto Qlx = quetta<lux>;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
@@ -0,0 +1,74 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qg = quecto<gram>;
+inline constexpr auto rg = ronto<gram>;
+inline constexpr auto yg = yocto<gram>;
+inline constexpr auto zg = zepto<gram>;
+inline constexpr auto ag = atto<gram>;
+inline constexpr auto fg = femto<gram>;
+inline constexpr auto pg = pico<gram>;
+inline constexpr auto ng = nano<gram>;
+inline constexpr auto ug = micro<gram>;
+inline constexpr auto mg = milli<gram>;
+inline constexpr auto cg = centi<gram>;
+inline constexpr auto dg = deci<gram>;
+inline constexpr auto g = gram;
+inline constexpr auto dag = deca<gram>;
+inline constexpr auto hg = hecto<gram>;
+inline constexpr auto kg = kilogram;
+inline constexpr auto Mg = mega<gram>;
+inline constexpr auto Gg = giga<gram>;
+inline constexpr auto Tg = tera<gram>;
+inline constexpr auto Pg = peta<gram>;
+inline constexpr auto Eg = exa<gram>;
+inline constexpr auto Zg = zetta<gram>;
+inline constexpr auto Yg = yotta<gram>;
+inline constexpr auto Rg = ronna<gram>;
+inline constexpr auto Qg = quetta<gram>;
+
+}  // namespace si::unit_symbols
+
+namespace non_si::unit_symbols {
+
+// TODO Should the following non-SI units have prefixed symbols predefiend as well?
+inline constexpr auto t = tonne;
+inline constexpr auto Da = dalton;
+
+}  // namespace non_si::unit_symbols
+
+namespace si::unit_symbols {
+
+using namespace non_si::unit_symbols;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
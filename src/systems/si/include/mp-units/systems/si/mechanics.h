@@ -0,0 +1,151 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qN = quecto<newton>;
+inline constexpr auto rN = ronto<newton>;
+inline constexpr auto yN = yocto<newton>;
+inline constexpr auto zN = zepto<newton>;
+inline constexpr auto aN = atto<newton>;
+inline constexpr auto fN = femto<newton>;
+inline constexpr auto pN = pico<newton>;
+inline constexpr auto nN = nano<newton>;
+inline constexpr auto uN = micro<newton>;
+inline constexpr auto mN = milli<newton>;
+inline constexpr auto cN = centi<newton>;
+inline constexpr auto dN = deci<newton>;
+inline constexpr auto N = newton;
+inline constexpr auto daN = deca<newton>;
+inline constexpr auto hN = hecto<newton>;
+inline constexpr auto kN = kilo<newton>;
+inline constexpr auto MN = mega<newton>;
+inline constexpr auto GN = giga<newton>;
+inline constexpr auto TN = tera<newton>;
+inline constexpr auto PN = peta<newton>;
+inline constexpr auto EN = exa<newton>;
+inline constexpr auto ZN = zetta<newton>;
+inline constexpr auto YN = yotta<newton>;
+inline constexpr auto RN = ronna<newton>;
+inline constexpr auto QN = quetta<newton>;
+
+inline constexpr auto qPa = quecto<pascal>;
+inline constexpr auto rPa = ronto<pascal>;
+inline constexpr auto yPa = yocto<pascal>;
+inline constexpr auto zPa = zepto<pascal>;
+inline constexpr auto aPa = atto<pascal>;
+inline constexpr auto fPa = femto<pascal>;
+inline constexpr auto pPa = pico<pascal>;
+inline constexpr auto nPa = nano<pascal>;
+inline constexpr auto uPa = micro<pascal>;
+inline constexpr auto mPa = milli<pascal>;
+inline constexpr auto cPa = centi<pascal>;
+inline constexpr auto dPa = deci<pascal>;
+inline constexpr auto Pa = pascal;
+inline constexpr auto daPa = deca<pascal>;
+inline constexpr auto hPa = hecto<pascal>;
+inline constexpr auto kPa = kilo<pascal>;
+inline constexpr auto MPa = mega<pascal>;
+inline constexpr auto GPa = giga<pascal>;
+inline constexpr auto TPa = tera<pascal>;
+inline constexpr auto PPa = peta<pascal>;
+inline constexpr auto EPa = exa<pascal>;
+inline constexpr auto ZPa = zetta<pascal>;
+inline constexpr auto YPa = yotta<pascal>;
+inline constexpr auto RPa = ronna<pascal>;
+inline constexpr auto QPa = quetta<pascal>;
+
+inline constexpr auto qJ = quecto<joule>;
+inline constexpr auto rJ = ronto<joule>;
+inline constexpr auto yJ = yocto<joule>;
+inline constexpr auto zJ = zepto<joule>;
+inline constexpr auto aJ = atto<joule>;
+inline constexpr auto fJ = femto<joule>;
+inline constexpr auto pJ = pico<joule>;
+inline constexpr auto nJ = nano<joule>;
+inline constexpr auto uJ = micro<joule>;
+inline constexpr auto mJ = milli<joule>;
+inline constexpr auto cJ = centi<joule>;
+inline constexpr auto dJ = deci<joule>;
+inline constexpr auto J = joule;
+inline constexpr auto daJ = deca<joule>;
+inline constexpr auto hJ = hecto<joule>;
+inline constexpr auto kJ = kilo<joule>;
+inline constexpr auto MJ = mega<joule>;
+inline constexpr auto GJ = giga<joule>;
+inline constexpr auto TJ = tera<joule>;
+inline constexpr auto PJ = peta<joule>;
+inline constexpr auto EJ = exa<joule>;
+inline constexpr auto ZJ = zetta<joule>;
+inline constexpr auto YJ = yotta<joule>;
+inline constexpr auto RJ = ronna<joule>;
+inline constexpr auto QJ = quetta<joule>;
+
+inline constexpr auto qW = quecto<watt>;
+inline constexpr auto rW = ronto<watt>;
+inline constexpr auto yW = yocto<watt>;
+inline constexpr auto zW = zepto<watt>;
+inline constexpr auto aW = atto<watt>;
+inline constexpr auto fW = femto<watt>;
+inline constexpr auto pW = pico<watt>;
+inline constexpr auto nW = nano<watt>;
+inline constexpr auto uW = micro<watt>;
+inline constexpr auto mW = milli<watt>;
+inline constexpr auto cW = centi<watt>;
+inline constexpr auto dW = deci<watt>;
+inline constexpr auto W = watt;
+inline constexpr auto daW = deca<watt>;
+inline constexpr auto hW = hecto<watt>;
+inline constexpr auto kW = kilo<watt>;
+inline constexpr auto MW = mega<watt>;
+inline constexpr auto GW = giga<watt>;
+inline constexpr auto TW = tera<watt>;
+inline constexpr auto PW = peta<watt>;
+inline constexpr auto EW = exa<watt>;
+inline constexpr auto ZW = zetta<watt>;
+inline constexpr auto YW = yotta<watt>;
+inline constexpr auto RW = ronna<watt>;
+inline constexpr auto QW = quetta<watt>;
+
+}  // namespace si::unit_symbols
+
+namespace non_si::unit_symbols {
+
+// TODO Should the following non-SI units have prefixed symbols predefiend as well?
+inline constexpr auto eV = electronvolt;
+
+}  // namespace non_si::unit_symbols
+
+namespace si::unit_symbols {
+
+using namespace non_si::unit_symbols;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
@@ -0,0 +1,63 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qK = quecto<kelvin>;
+inline constexpr auto rK = ronto<kelvin>;
+inline constexpr auto yK = yocto<kelvin>;
+inline constexpr auto zK = zepto<kelvin>;
+inline constexpr auto aK = atto<kelvin>;
+inline constexpr auto fK = femto<kelvin>;
+inline constexpr auto pK = pico<kelvin>;
+inline constexpr auto nK = nano<kelvin>;
+inline constexpr auto uK = micro<kelvin>;
+inline constexpr auto mK = milli<kelvin>;
+inline constexpr auto cK = centi<kelvin>;
+inline constexpr auto dK = deci<kelvin>;
+inline constexpr auto K = kelvin;
+inline constexpr auto daK = deca<kelvin>;
+inline constexpr auto hK = hecto<kelvin>;
+inline constexpr auto kK = kilo<kelvin>;
+inline constexpr auto MK = mega<kelvin>;
+inline constexpr auto GK = giga<kelvin>;
+inline constexpr auto TK = tera<kelvin>;
+inline constexpr auto PK = peta<kelvin>;
+inline constexpr auto EK = exa<kelvin>;
+inline constexpr auto ZK = zetta<kelvin>;
+inline constexpr auto YK = yotta<kelvin>;
+inline constexpr auto RK = ronna<kelvin>;
+inline constexpr auto QK = quetta<kelvin>;
+
+// no prefixes should be provided for the below units
+inline constexpr auto deg_C = degree_Celsius;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
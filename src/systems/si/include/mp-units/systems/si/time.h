@@ -0,0 +1,80 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+
+namespace mp_units {
+
+namespace si::unit_symbols {
+
+inline constexpr auto qs = quecto<second>;
+inline constexpr auto rs = ronto<second>;
+inline constexpr auto ys = yocto<second>;
+inline constexpr auto zs = zepto<second>;
+inline constexpr auto as = atto<second>;
+inline constexpr auto fs = femto<second>;
+inline constexpr auto ps = pico<second>;
+inline constexpr auto ns = nano<second>;
+inline constexpr auto us = micro<second>;
+inline constexpr auto ms = milli<second>;
+inline constexpr auto cs = centi<second>;
+inline constexpr auto ds = deci<second>;
+inline constexpr auto s = second;
+// TODO Should the below multiples of second be provided?
+inline constexpr auto das = deca<second>;
+inline constexpr auto hs = hecto<second>;
+inline constexpr auto ks = kilo<second>;
+inline constexpr auto Ms = mega<second>;
+inline constexpr auto Gs = giga<second>;
+inline constexpr auto Ts = tera<second>;
+inline constexpr auto Ps = peta<second>;
+inline constexpr auto Es = exa<second>;
+inline constexpr auto Zs = zetta<second>;
+inline constexpr auto Ys = yotta<second>;
+inline constexpr auto Rs = ronna<second>;
+inline constexpr auto Qs = quetta<second>;
+
+// commonly used squared and cubic units
+inline constexpr auto s2 = square(second);
+inline constexpr auto s3 = cubic(second);
+
+}  // namespace si::unit_symbols
+
+namespace non_si::unit_symbols {
+
+// no prefixes should be provided for the below units
+inline constexpr auto min = minute;
+inline constexpr auto h = hour;
+inline constexpr auto d = day;
+
+}  // namespace non_si::unit_symbols
+
+namespace si::unit_symbols {
+
+using namespace non_si::unit_symbols;
+
+}  // namespace si::unit_symbols
+
+}  // namespace mp_units
@@ -0,0 +1,250 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_point.h>
+#include <gsl/gsl-lite.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace mp_units {
+
+namespace detail {
+
+// `std::hardware_destructive_interference_size` is not available everywhere and is not meant to be used in headers
+inline constexpr std::size_t cache_line_size = 64;
+
+template<typename T>
+struct atomic_quantity_traits;
+
+template<Quantity Q>
+struct atomic_quantity_traits<Q> {
+  using rep = MP_UNITS_TYPENAME Q::rep;
+  using difference_type = Q;
+  [[nodiscard]] static constexpr rep& numerical_value(Q& q) noexcept { return q.numerical_value(); }
+  [[nodiscard]] static constexpr rep numerical_value(const Q& q) noexcept { return q.numerical_value(); }
+  [[nodiscard]] static constexpr Q make(rep v) noexcept { return make_quantity<Q::reference>(v); }
+};
+
+template<QuantityPoint QP>
+struct atomic_quantity_traits<QP> {
+  using rep = MP_UNITS_TYPENAME QP::rep;
+  using difference_type = MP_UNITS_TYPENAME QP::quantity_type;
+  [[nodiscard]] static constexpr rep& numerical_value(QP& qp) noexcept
+  {
+    return qp.quantity_from_origin().numerical_value();
+  }
+  [[nodiscard]] static constexpr rep numerical_value(const QP& qp) noexcept
+  {
+    return qp.quantity_from_origin().numerical_value();
+  }
+  [[nodiscard]] static constexpr QP make(rep v) noexcept
+  {
+    return make_quantity_point<QP::point_origin>(make_quantity<QP::reference>(v));
+  }
+};
+
+/**
+ * @brief Atomic operations on the numerical value of a quantity or a quantity point
+ *
+ * @tparam T a quantity or a quantity point type
+ * @tparam Atomic `std::atomic` or `std::atomic_ref` of the representation type of `T`
+ */
+template<typename T, typename Atomic>
+class atomic_quantity_base {
+  using traits = atomic_quantity_traits<T>;
+
+public:
+  using value_type = T;
+  using difference_type = MP_UNITS_TYPENAME traits::difference_type;
+
+  static constexpr bool is_always_lock_free = Atomic::is_always_lock_free;
+
+  [[nodiscard]] bool is_lock_free() const noexcept { return atomic_.is_lock_free(); }
+
+  void store(const T& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    atomic_.store(traits::numerical_value(desired), order);
+  }
+
+  [[nodiscard]] T load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    return traits::make(atomic_.load(order));
+  }
+
+  operator T() const noexcept { return load(); }
+
+  T operator=(const T& desired) noexcept
+  {
+    store(desired);
+    return desired;
+  }
+
+  T exchange(const T& desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return traits::make(atomic_.exchange(traits::numerical_value(desired), order));
+  }
+
+  bool compare_exchange_weak(T& expected, const T& desired, std::memory_order success,
+                             std::memory_order failure) noexcept
+  {
+    return compare_exchange(expected, desired, [&](auto& e, auto d) {
+      return atomic_.compare_exchange_weak(e, d, success, failure);
+    });
+  }
+
+  bool compare_exchange_weak(T& expected, const T& desired,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return compare_exchange(expected, desired,
+                            [&](auto& e, auto d) { return atomic_.compare_exchange_weak(e, d, order); });
+  }
+
+  bool compare_exchange_strong(T& expected, const T& desired, std::memory_order success,
+                               std::memory_order failure) noexcept
+  {
+    return compare_exchange(expected, desired, [&](auto& e, auto d) {
+      return atomic_.compare_exchange_strong(e, d, success, failure);
+    });
+  }
+
+  bool compare_exchange_strong(T& expected, const T& desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return compare_exchange(expected, desired,
+                            [&](auto& e, auto d) { return atomic_.compare_exchange_strong(e, d, order); });
+  }
+
+  /**
+   * @brief Atomically adds a quantity and returns the previous value
+   *
+   * An argument in a different unit is converted to the unit of `T` before the read-modify-write
+   * operation (only value-preserving conversions are implicit).
+   */
+  T fetch_add(const difference_type& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return traits::make(atomic_.fetch_add(arg.numerical_value(), order));
+  }
+
+  /**
+   * @brief Atomically subtracts a quantity and returns the previous value
+   */
+  T fetch_sub(const difference_type& arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return traits::make(atomic_.fetch_sub(arg.numerical_value(), order));
+  }
+
+  T operator+=(const difference_type& arg) noexcept { return fetch_add(arg) + arg; }
+  T operator-=(const difference_type& arg) noexcept { return fetch_sub(arg) - arg; }
+
+protected:
+  Atomic atomic_;
+
+  template<typename... Args>
+  constexpr explicit atomic_quantity_base(Args&&... args) noexcept : atomic_(std::forward<Args>(args)...)
+  {
+  }
+
+private:
+  template<typename Func>
+  bool compare_exchange(T& expected, const T& desired, Func func) noexcept
+  {
+    auto e = traits::numerical_value(expected);
+    const bool res = func(e, traits::numerical_value(desired));
+    if (!res) expected = traits::make(e);
+    return res;
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief An atomic quantity
+ *
+ * Provides the interface of `std::atomic` with quantities in place of numbers. It is lock-free
+ * whenever `std::atomic<Q::rep>` is.
+ *
+ * @code{.cpp}
+ * atomic_quantity<quantity<iec80000::byte, std::uint64_t>> transferred;
+ * transferred.fetch_add(1 * iec80000::kilobyte, std::memory_order_relaxed);  // adds 1000 B
+ * @endcode
+ */
+template<Quantity Q>
+class atomic_quantity : public detail::atomic_quantity_base<Q, std::atomic<typename Q::rep>> {
+  using base = detail::atomic_quantity_base<Q, std::atomic<typename Q::rep>>;
+
+public:
+  constexpr atomic_quantity() noexcept : base() {}
+  constexpr atomic_quantity(const Q& q) noexcept : base(q.numerical_value()) {}
+  atomic_quantity(const atomic_quantity&) = delete;
+  atomic_quantity& operator=(const atomic_quantity&) = delete;
+  using base::operator=;
+};
+
+/**
+ * @brief An atomic quantity point
+ *
+ * Stores the quantity from the origin of `QP`, which is atomically shifted with `fetch_add` and
+ * `fetch_sub`.
+ */
+template<QuantityPoint QP>
+class atomic_quantity_point : public detail::atomic_quantity_base<QP, std::atomic<typename QP::rep>> {
+  using base = detail::atomic_quantity_base<QP, std::atomic<typename QP::rep>>;
+
+public:
+  constexpr atomic_quantity_point() noexcept : base() {}
+  constexpr atomic_quantity_point(const QP& qp) noexcept : base(qp.quantity_from_origin().numerical_value()) {}
+  atomic_quantity_point(const atomic_quantity_point&) = delete;
+  atomic_quantity_point& operator=(const atomic_quantity_point&) = delete;
+  using base::operator=;
+};
+
+/**
+ * @brief Atomic operations on an existing quantity or quantity point
+ *
+ * The `std::atomic_ref` counterpart of `atomic_quantity` and `atomic_quantity_point` (e.g. to
+ * update elements of an array of quantities from many threads). While any `atomic_quantity_ref`
+ * references an object, the object has to be accessed only through `atomic_quantity_ref`
+ * instances.
+ */
+template<typename T>
+  requires Quantity<T> || QuantityPoint<T>
+class atomic_quantity_ref :
+    public detail::atomic_quantity_base<T, std::atomic_ref<typename T::rep>> {
+  using base = detail::atomic_quantity_base<T, std::atomic_ref<typename T::rep>>;
+
+public:
+  static constexpr std::size_t required_alignment = std::atomic_ref<typename T::rep>::required_alignment;
+
+  explicit atomic_quantity_ref(T& obj) : base(detail::atomic_quantity_traits<T>::numerical_value(obj))
+  {
+    gsl_Expects(reinterpret_cast<std::uintptr_t>(&obj) % required_alignment == 0);
+  }
+  atomic_quantity_ref(const atomic_quantity_ref&) noexcept = default;
+  atomic_quantity_ref& operator=(const atomic_quantity_ref&) = delete;
+  using base::operator=;
+};
+
+}  // namespace mp_units
@@ -22,12 +22,28 @@
 
 #pragma once
 
+#include <mp-units/bits/external/hacks.h>
+#include <mp-units/bits/value_cast.h>
 #include <mp-units/customization_points.h>
 #include <mp-units/quantity_point.h>
 #include <mp-units/systems/isq/space_and_time.h>
 #include <mp-units/systems/si/prefixes.h>
 #include <mp-units/systems/si/units.h>
 #include <chrono>
+#include <cstdint>
+#include <ratio>
+
+#ifndef MP_UNITS_HAS_TSC_CLOCK
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define MP_UNITS_HAS_TSC_CLOCK 1
+#else
+#define MP_UNITS_HAS_TSC_CLOCK 0
+#endif
+#endif
+
+#if MP_UNITS_HAS_TSC_CLOCK && MP_UNITS_COMP_MSVC
+#include <intrin.h>
+#endif
 
 namespace mp_units {
 
@@ -75,6 +91,49 @@ template<typename C>
 inline constexpr chrono_point_origin_<C> chrono_point_origin;
 
 
+/**
+ * @brief A high-resolution timestamp of a `std::chrono` clock
+ *
+ * An integral number of `Period` ticks since the epoch of `Clock`. With the defaults it covers
+ * about 292 years with a nanosecond resolution, and conversions from and to
+ * `std::chrono::time_point<Clock, std::chrono::duration<Rep, Period>>` are plain copies of the tick count.
+ *
+ * @tparam Clock the clock which epoch is the origin of the timestamp
+ * @tparam Period the duration of one tick
+ * @tparam Rep an integral type counting the ticks
+ */
+template<typename Clock, typename Period = std::nano, std::integral Rep = std::int64_t>
+using chrono_timestamp = quantity_point<isq::time[detail::time_unit_from_chrono_period<Period>()],
+                                        chrono_point_origin<Clock>, Rep>;
+
+/**
+ * @brief Converts a duration to the ticks of a timestamp
+ *
+ * The duration is rounded to the nearest tick (halfway cases away from zero) so that it can be
+ * added to or subtracted from the timestamp with integral arithmetic. This makes it possible to
+ * advance a timestamp by floating-point durations any number of times without accumulating
+ * a floating-point error in the timestamp itself.
+ *
+ * @code{.cpp}
+ * ts += tick_cast<decltype(ts)>(0.25 * us);
+ * @endcode
+ *
+ * @tparam TS the timestamp type which ticks should be used
+ * @param d the duration to convert
+ */
+template<QuantityPointOf<isq::time> TS, QuantityOf<isq::time> Q>
+  requires(!treat_as_floating_point<typename TS::rep>)
+[[nodiscard]] constexpr quantity<TS::reference, typename TS::rep> tick_cast(const Q& d)
+{
+  using rep = MP_UNITS_TYPENAME TS::rep;
+  if constexpr (std::convertible_to<Q, quantity<TS::reference, rep>>)
+    return d;
+  else {
+    const long double ticks = value_cast<long double>(d).numerical_value_in(TS::unit);
+    return make_quantity<TS::reference>(static_cast<rep>(ticks < 0 ? ticks - 0.5L : ticks + 0.5L));
+  }
+}
+
 template<typename C, typename Rep, typename Period>
 struct quantity_point_like_traits<std::chrono::time_point<C, std::chrono::duration<Rep, Period>>> {
   static constexpr auto reference = detail::time_unit_from_chrono_period<Period>();
@@ -107,4 +166,118 @@ template<QuantityPointOf<isq::time> QP>
   return ret_type(to_chrono_duration(qp - qp.absolute_point_origin));
 }
 
+/**
+ * @brief An adaptor of a `std::chrono` clock returning quantity points
+ *
+ * `now()` returns a `quantity_point` measured from `chrono_point_origin<C>` directly in the requested
+ * unit and representation type. If the clock's tick is finer than `U` and `Rep` is an integral type
+ * the time is truncated towards the epoch.
+ *
+ * @code{.cpp}
+ * using clock = quantity_clock<std::chrono::steady_clock, si::micro<si::second>>;
+ * const clock::time_point start = clock::now();
+ * // ...
+ * const quantity<isq::time[us], std::int64_t> latency = clock::now() - start;
+ * @endcode
+ *
+ * @tparam C a `std::chrono` clock
+ * @tparam U a unit of the returned time points
+ * @tparam Rep a representation type of the returned time points
+ */
+template<typename C, Unit auto U = detail::time_unit_from_chrono_period<typename C::period>(),
+         RepresentationOf<quantity_character::scalar> Rep = typename C::rep>
+struct quantity_clock {
+  using clock = C;
+  using rep = Rep;
+  using time_point = quantity_point<isq::time[U], chrono_point_origin<C>, Rep>;
+  static constexpr Unit auto unit = U;
+  static constexpr bool is_steady = C::is_steady;
+
+  [[nodiscard]] static time_point now() noexcept(noexcept(C::now()))
+  {
+    if constexpr (std::constructible_from<time_point, typename C::time_point>)
+      return time_point(C::now());
+    else {
+      const quantity q{C::now().time_since_epoch()};
+      if constexpr (treat_as_floating_point<Rep>)
+        return chrono_point_origin<C> + value_cast<U>(value_cast<Rep>(q));
+      else
+        return chrono_point_origin<C> + value_cast<Rep>(value_cast<U>(q));
+    }
+  }
+};
+
+#if MP_UNITS_HAS_TSC_CLOCK
+
+/**
+ * @brief A `std::chrono` clock reading the time stamp counter of the CPU
+ *
+ * Reading the counter is much cheaper than a system call, which makes the clock suitable for
+ * instrumenting hot loops. The counter frequency is calibrated against `std::chrono::steady_clock`
+ * on the first use of the clock (a busy wait of about 10 ms) and the clock shares its epoch with
+ * `std::chrono::steady_clock`.
+ *
+ * The clock requires an invariant TSC (running at a constant rate in all power states and
+ * synchronized between cores) which is provided by all the modern x86 processors.
+ */
+struct tsc_clock {
+  using rep = std::int64_t;
+  using period = std::nano;
+  using duration = std::chrono::duration<rep, period>;
+  using time_point = std::chrono::time_point<tsc_clock>;
+  static constexpr bool is_steady = true;
+
+  [[nodiscard]] static std::uint64_t ticks() noexcept
+  {
+#if MP_UNITS_COMP_MSVC
+    return __rdtsc();
+#else
+    return __builtin_ia32_rdtsc();
+#endif
+  }
+
+  [[nodiscard]] static time_point now() noexcept
+  {
+    const calibration_data& c = calibration();
+    const auto elapsed = static_cast<double>(static_cast<std::int64_t>(ticks() - c.tsc_base)) * c.ns_per_tick;
+    return time_point(duration(c.steady_base + static_cast<rep>(elapsed)));
+  }
+
+  /**
+   * @brief The calibrated frequency of the time stamp counter
+   */
+  [[nodiscard]] static quantity<isq::frequency[si::hertz]> frequency() noexcept
+  {
+    return (1e9 / calibration().ns_per_tick) * isq::frequency[si::hertz];
+  }
+
+private:
+  struct calibration_data {
+    rep steady_base;
+    std::uint64_t tsc_base;
+    double ns_per_tick;
+  };
+
+  [[nodiscard]] static const calibration_data& calibration() noexcept
+  {
+    static const calibration_data data = [] {
+      using std::chrono::steady_clock;
+      const steady_clock::time_point steady_start = steady_clock::now();
+      const std::uint64_t tsc_start = ticks();
+      steady_clock::time_point steady_end = steady_start;
+      std::uint64_t tsc_end = tsc_start;
+      do {
+        steady_end = steady_clock::now();
+        tsc_end = ticks();
+      } while (steady_end - steady_start < std::chrono::milliseconds(10));
+      const std::chrono::duration<double, std::nano> elapsed = steady_end - steady_start;
+      return calibration_data{std::chrono::duration_cast<duration>(steady_end.time_since_epoch()).count(), tsc_end,
+                              elapsed.count() / static_cast<double>(tsc_end - tsc_start)};
+    }();
+    return data;
+  }
+};
+
+#endif  // MP_UNITS_HAS_TSC_CLOCK
+
 }  // namespace mp_units
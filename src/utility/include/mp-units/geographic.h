@@ -0,0 +1,381 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/quantity.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/units.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace mp_units {
+
+/**
+ * @brief The mean radius of the Earth (IUGG)
+ */
+inline constexpr auto earth_mean_radius = 6'371'008.8 * isq::radius[si::metre];
+
+/**
+ * @brief A reference ellipsoid of revolution
+ */
+struct ellipsoid {
+  quantity<isq::radius[si::metre]> equatorial_radius;
+  double flattening;
+};
+
+inline constexpr ellipsoid wgs84{6'378'137. * isq::radius[si::metre], 1 / 298.257223563};
+
+/**
+ * @brief A geographic position given by its latitude and longitude
+ *
+ * The angles are stored in radians, so any other angular unit (e.g. `si::degree`) is converted
+ * once on construction.
+ */
+template<std::floating_point T = double>
+struct geographic_position {
+  quantity<si::radian, T> latitude;
+  quantity<si::radian, T> longitude;
+};
+
+/**
+ * @brief Geographic positions stored as separate arrays of their latitudes and longitudes
+ *
+ * The angles are converted to radians once when a position is added, and the cosine of the
+ * latitude, which every distance and bearing formula needs, is computed and stored as well.
+ * The batched kernels below process these arrays with loops free of any per-element
+ * conversions or range checks.
+ */
+template<std::floating_point T = double>
+class geographic_positions {
+public:
+  using value_type = geographic_position<T>;
+
+  geographic_positions() = default;
+
+  [[nodiscard]] std::size_t size() const { return lat_.size(); }
+  [[nodiscard]] bool empty() const { return lat_.empty(); }
+
+  void reserve(std::size_t size)
+  {
+    lat_.reserve(size);
+    lon_.reserve(size);
+    cos_lat_.reserve(size);
+  }
+
+  void clear()
+  {
+    lat_.clear();
+    lon_.clear();
+    cos_lat_.clear();
+  }
+
+  /**
+   * @brief Adds a position
+   *
+   * @note The latitude must be in [-90°, 90°].
+   */
+  void push_back(const value_type& p)
+  {
+    const T lat = p.latitude.numerical_value_in(si::radian);
+    gsl_Expects(std::abs(lat) <= std::numbers::pi_v<T> / 2);
+    lat_.push_back(lat);
+    lon_.push_back(p.longitude.numerical_value_in(si::radian));
+    cos_lat_.push_back(std::cos(lat));
+  }
+
+  [[nodiscard]] value_type operator[](std::size_t i) const
+  {
+    return {lat_[i] * si::radian, lon_[i] * si::radian};
+  }
+
+  /**
+   * @brief The latitudes in radians
+   */
+  [[nodiscard]] std::span<const T> latitudes() const { return lat_; }
+
+  /**
+   * @brief The longitudes in radians
+   */
+  [[nodiscard]] std::span<const T> longitudes() const { return lon_; }
+
+  [[nodiscard]] std::span<const T> cos_latitudes() const { return cos_lat_; }
+
+private:
+  std::vector<T> lat_;
+  std::vector<T> lon_;
+  std::vector<T> cos_lat_;
+};
+
+template<std::floating_point T = double>
+using geographic_distance = quantity<isq::distance[si::metre], T>;
+
+template<std::floating_point T = double>
+using geographic_bearing = quantity<si::radian, T>;
+
+namespace detail {
+
+// a position with its angles in radians and the precomputed cosine of its latitude
+template<std::floating_point T>
+struct geo_point {
+  T lat;
+  T lon;
+  T cos_lat;
+};
+
+template<std::floating_point T>
+[[nodiscard]] geo_point<T> to_geo_point(const geographic_position<T>& p)
+{
+  const T lat = p.latitude.numerical_value_in(si::radian);
+  return {lat, p.longitude.numerical_value_in(si::radian), std::cos(lat)};
+}
+
+// the batched kernels take their "from" positions either from an array or from a single position
+template<std::floating_point T>
+[[nodiscard]] auto geo_points(const geographic_positions<T>& p)
+{
+  return [lat = p.latitudes(), lon = p.longitudes(), cos_lat = p.cos_latitudes()](std::size_t i) {
+    return geo_point<T>{lat[i], lon[i], cos_lat[i]};
+  };
+}
+
+template<std::floating_point T>
+[[nodiscard]] auto geo_points(const geographic_position<T>& p)
+{
+  return [pt = to_geo_point(p)](std::size_t) { return pt; };
+}
+
+template<typename From, typename T>
+concept GeoPointSource = std::same_as<From, geographic_position<T>> || std::same_as<From, geographic_positions<T>>;
+
+template<std::floating_point T>
+[[nodiscard]] std::size_t geo_points_size(const geographic_positions<T>& p, std::size_t)
+{
+  return p.size();
+}
+
+template<std::floating_point T>
+[[nodiscard]] std::size_t geo_points_size(const geographic_position<T>&, std::size_t size)
+{
+  return size;
+}
+
+template<std::floating_point T>
+[[nodiscard]] T central_angle(const geo_point<T>& from, const geo_point<T>& to)
+{
+  // the haversine formula (well-conditioned also for small distances)
+  const T sin_lat = std::sin((to.lat - from.lat) / 2);
+  const T sin_lon = std::sin((to.lon - from.lon) / 2);
+  const T h = sin_lat * sin_lat + from.cos_lat * to.cos_lat * sin_lon * sin_lon;
+  return 2 * std::asin(std::sqrt(std::min(h, T{1})));
+}
+
+template<std::floating_point T>
+[[nodiscard]] T normalized_bearing(T y, T x)
+{
+  const T b = std::atan2(y, x);
+  return b < 0 ? b + 2 * std::numbers::pi_v<T> : b;
+}
+
+template<std::floating_point T>
+[[nodiscard]] T initial_bearing(const geo_point<T>& from, const geo_point<T>& to)
+{
+  const T d_lon = to.lon - from.lon;
+  return normalized_bearing(std::sin(d_lon) * to.cos_lat,
+                            from.cos_lat * std::sin(to.lat) - std::sin(from.lat) * to.cos_lat * std::cos(d_lon));
+}
+
+template<std::floating_point T>
+struct geodesic_values {
+  T distance;  // in the units of the ellipsoid's semi-axes
+  T bearing;
+};
+
+// the inverse problem on an ellipsoid solved with Vincenty's iterative method
+template<std::floating_point T>
+[[nodiscard]] geodesic_values<T> vincenty(const geo_point<T>& from, const geo_point<T>& to, T a, T f)
+{
+  constexpr int max_iterations = 200;
+  const T tolerance = std::max(T(1e-12), 4 * std::numeric_limits<T>::epsilon());
+  const T b = (1 - f) * a;
+
+  const T l = to.lon - from.lon;
+  const T u1 = std::atan((1 - f) * std::tan(from.lat));
+  const T u2 = std::atan((1 - f) * std::tan(to.lat));
+  const T sin_u1 = std::sin(u1), cos_u1 = std::cos(u1);
+  const T sin_u2 = std::sin(u2), cos_u2 = std::cos(u2);
+
+  T lambda = l;
+  T sin_lambda{}, cos_lambda{}, sin_sigma{}, cos_sigma{}, sigma{}, cos2_alpha{}, cos_2sigma_m{};
+  bool converged = false;
+  for (int i = 0; i < max_iterations && !converged; ++i) {
+    sin_lambda = std::sin(lambda);
+    cos_lambda = std::cos(lambda);
+    const T x = cos_u2 * sin_lambda;
+    const T y = cos_u1 * sin_u2 - sin_u1 * cos_u2 * cos_lambda;
+    sin_sigma = std::sqrt(x * x + y * y);
+    if (sin_sigma == 0) return {T{}, T{}};  // coincident points
+    cos_sigma = sin_u1 * sin_u2 + cos_u1 * cos_u2 * cos_lambda;
+    sigma = std::atan2(sin_sigma, cos_sigma);
+    const T sin_alpha = cos_u1 * cos_u2 * sin_lambda / sin_sigma;
+    cos2_alpha = 1 - sin_alpha * sin_alpha;
+    // the geodesic along the equator has cos2_alpha == 0
+    cos_2sigma_m = cos2_alpha != 0 ? cos_sigma - 2 * sin_u1 * sin_u2 / cos2_alpha : T{};
+    const T c = f / 16 * cos2_alpha * (4 + f * (4 - 3 * cos2_alpha));
+    const T previous = lambda;
+    lambda = l + (1 - c) * f * sin_alpha *
+                   (sigma + c * sin_sigma * (cos_2sigma_m + c * cos_sigma * (-1 + 2 * cos_2sigma_m * cos_2sigma_m)));
+    converged = std::abs(lambda - previous) <= tolerance;
+  }
+  // the method does not converge for some nearly antipodal points
+  if (!converged) return {std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::quiet_NaN()};
+
+  const T u_sq = cos2_alpha * (a * a - b * b) / (b * b);
+  const T big_a = 1 + u_sq / 16384 * (4096 + u_sq * (-768 + u_sq * (320 - 175 * u_sq)));
+  const T big_b = u_sq / 1024 * (256 + u_sq * (-128 + u_sq * (74 - 47 * u_sq)));
+  const T cos2_2sigma_m = cos_2sigma_m * cos_2sigma_m;
+  const T delta_sigma =
+    big_b * sin_sigma *
+    (cos_2sigma_m + big_b / 4 *
+                      (cos_sigma * (-1 + 2 * cos2_2sigma_m) -
+                       big_b / 6 * cos_2sigma_m * (-3 + 4 * sin_sigma * sin_sigma) * (-3 + 4 * cos2_2sigma_m)));
+  return {b * big_a * (sigma - delta_sigma),
+          normalized_bearing(cos_u2 * sin_lambda, cos_u1 * sin_u2 - sin_u1 * cos_u2 * cos_lambda)};
+}
+
+}  // namespace detail
+
+/**
+ * @brief The great-circle distance between two positions on a sphere (the haversine formula)
+ */
+template<std::floating_point T>
+[[nodiscard]] geographic_distance<T> haversine_distance(
+  const geographic_position<T>& from, const geographic_position<T>& to,
+  std::type_identity_t<quantity<isq::radius[si::metre], T>> radius = earth_mean_radius)
+{
+  const T angle = detail::central_angle(detail::to_geo_point(from), detail::to_geo_point(to));
+  return radius.numerical_value_in(si::metre) * angle * isq::distance[si::metre];
+}
+
+/**
+ * @brief The great-circle distances between the positions `from[i]` (or a single position `from`)
+ * and `to[i]` written to `out[i]`
+ *
+ * The loop has no branches and no conversions, so compilers that provide vectorized math
+ * functions (e.g. GCC with glibc's libmvec and `-ffast-math`) process several pairs with
+ * every SIMD instruction.
+ */
+template<std::floating_point T, detail::GeoPointSource<T> From>
+void haversine_distance(const From& from, const geographic_positions<T>& to,
+                        std::type_identity_t<std::span<geographic_distance<T>>> out,
+                        std::type_identity_t<quantity<isq::radius[si::metre], T>> radius = earth_mean_radius)
+{
+  gsl_Expects(detail::geo_points_size(from, to.size()) == to.size() && out.size() == to.size());
+  const auto from_points = detail::geo_points(from);
+  const auto to_points = detail::geo_points(to);
+  const T r = radius.numerical_value_in(si::metre);
+  for (std::size_t i = 0; i < out.size(); ++i)
+    out[i] = r * detail::central_angle(from_points(i), to_points(i)) * isq::distance[si::metre];
+}
+
+/**
+ * @brief The initial bearing (forward azimuth) of the great circle from one position to another
+ *
+ * The bearing is measured clockwise from the north in [0, 2π).
+ */
+template<std::floating_point T>
+[[nodiscard]] geographic_bearing<T> initial_bearing(const geographic_position<T>& from,
+                                                    const geographic_position<T>& to)
+{
+  return detail::initial_bearing(detail::to_geo_point(from), detail::to_geo_point(to)) * si::radian;
+}
+
+template<std::floating_point T, detail::GeoPointSource<T> From>
+void initial_bearing(const From& from, const geographic_positions<T>& to,
+                     std::type_identity_t<std::span<geographic_bearing<T>>> out)
+{
+  gsl_Expects(detail::geo_points_size(from, to.size()) == to.size() && out.size() == to.size());
+  const auto from_points = detail::geo_points(from);
+  const auto to_points = detail::geo_points(to);
+  for (std::size_t i = 0; i < out.size(); ++i)
+    out[i] = detail::initial_bearing(from_points(i), to_points(i)) * si::radian;
+}
+
+/**
+ * @brief The distance and the initial bearing of the geodesic between two positions
+ */
+template<std::floating_point T>
+struct geodesic {
+  geographic_distance<T> distance;
+  geographic_bearing<T> initial_bearing;
+};
+
+/**
+ * @brief The geodesic between two positions on an ellipsoid (Vincenty's inverse method)
+ *
+ * The distance is accurate to within a millimetre on the WGS 84 ellipsoid. Both the distance and the
+ * bearing are NaN for nearly antipodal points for which the method does not converge.
+ */
+template<std::floating_point T>
+[[nodiscard]] geodesic<T> vincenty_inverse(const geographic_position<T>& from, const geographic_position<T>& to,
+                                           const ellipsoid& e = wgs84)
+{
+  const auto g = detail::vincenty(detail::to_geo_point(from), detail::to_geo_point(to),
+                                  static_cast<T>(e.equatorial_radius.numerical_value_in(si::metre)),
+                                  static_cast<T>(e.flattening));
+  return {g.distance * isq::distance[si::metre], g.bearing * si::radian};
+}
+
+/**
+ * @brief The geodesics between the positions `from[i]` (or a single position `from`) and `to[i]`
+ *
+ * The distances are written to `distances[i]` and, if `bearings` is not empty, the initial bearings
+ * to `bearings[i]`.
+ */
+template<std::floating_point T, detail::GeoPointSource<T> From>
+void vincenty_inverse(const From& from, const geographic_positions<T>& to,
+                      std::type_identity_t<std::span<geographic_distance<T>>> distances,
+                      std::type_identity_t<std::span<geographic_bearing<T>>> bearings = {},
+                      const ellipsoid& e = wgs84)
+{
+  gsl_Expects(detail::geo_points_size(from, to.size()) == to.size() && distances.size() == to.size());
+  gsl_Expects(bearings.empty() || bearings.size() == to.size());
+  const auto from_points = detail::geo_points(from);
+  const auto to_points = detail::geo_points(to);
+  const T a = static_cast<T>(e.equatorial_radius.numerical_value_in(si::metre));
+  const T f = static_cast<T>(e.flattening);
+  for (std::size_t i = 0; i < distances.size(); ++i) {
+    const auto g = detail::vincenty(from_points(i), to_points(i), a, f);
+    distances[i] = g.distance * isq::distance[si::metre];
+    if (!bearings.empty()) bearings[i] = g.bearing * si::radian;
+  }
+}
+
+}  // namespace mp_units
@@ -0,0 +1,391 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/value_cast.h>
+#include <mp-units/quantity.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace mp_units {
+
+namespace detail {
+
+template<typename Rep>
+using histogram_calc_rep = std::conditional_t<treat_as_floating_point<Rep>, Rep, double>;
+
+}  // namespace detail
+
+/**
+ * @brief Bins of equal width between two quantities
+ *
+ * The edges are converted to the unit of `Q` once, so that recording a sample of `Q` does not need
+ * any unit conversion.
+ */
+template<Quantity Q>
+class linear_bins {
+public:
+  using calc_rep = detail::histogram_calc_rep<typename Q::rep>;
+  using value_type = quantity<Q::reference, calc_rep>;
+
+  linear_bins(const value_type& lo, const value_type& hi, std::size_t count) :
+      lo_(lo.numerical_value()),
+      width_((hi - lo).numerical_value() / static_cast<calc_rep>(count)),
+      inv_width_(static_cast<calc_rep>(count) / (hi - lo).numerical_value()),
+      count_(count)
+  {
+    gsl_Expects(count > 0 && lo < hi);
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return count_; }
+
+  /**
+   * @brief Returns `0` for values below the first bin, `size() + 1` for values above the last one, or the bin number
+   * increased by 1
+   */
+  [[nodiscard]] std::size_t index(calc_rep v) const noexcept
+  {
+    const calc_rep pos = (v - lo_) * inv_width_;
+    if (!(pos >= 0)) return 0;
+    if (pos >= static_cast<calc_rep>(count_)) return count_ + 1;
+    return static_cast<std::size_t>(pos) + 1;
+  }
+
+  [[nodiscard]] calc_rep edge(std::size_t i) const noexcept { return lo_ + width_ * static_cast<calc_rep>(i); }
+
+  [[nodiscard]] calc_rep interpolate(std::size_t bin, calc_rep fraction) const noexcept
+  {
+    return lo_ + width_ * (static_cast<calc_rep>(bin) + fraction);
+  }
+
+  [[nodiscard]] friend bool operator==(const linear_bins&, const linear_bins&) = default;
+
+private:
+  calc_rep lo_;
+  calc_rep width_;
+  calc_rep inv_width_;
+  std::size_t count_;
+};
+
+/**
+ * @brief Bins which edges form a geometric progression between two positive quantities
+ *
+ * Every bin covers the same ratio of values which suits quantities spanning many orders of magnitude
+ * (e.g. latencies).
+ */
+template<Quantity Q>
+class log_bins {
+public:
+  using calc_rep = detail::histogram_calc_rep<typename Q::rep>;
+  using value_type = quantity<Q::reference, calc_rep>;
+
+  log_bins(const value_type& lo, const value_type& hi, std::size_t count) :
+      lo_(lo.numerical_value()),
+      hi_(hi.numerical_value()),
+      log_lo_(std::log(lo.numerical_value())),
+      log_ratio_((std::log(hi.numerical_value()) - std::log(lo.numerical_value())) / static_cast<calc_rep>(count)),
+      inv_log_ratio_(calc_rep{1} / log_ratio_),
+      count_(count)
+  {
+    gsl_Expects(count > 0 && value_type::zero() < lo && lo < hi);
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return count_; }
+
+  /**
+   * @brief Returns `0` for values below the first bin, `size() + 1` for values above the last one, or the bin number
+   * increased by 1
+   */
+  [[nodiscard]] std::size_t index(calc_rep v) const noexcept
+  {
+    if (!(v >= lo_)) return 0;
+    const calc_rep pos = (std::log(v) - log_lo_) * inv_log_ratio_;
+    if (pos >= static_cast<calc_rep>(count_)) return count_ + 1;
+    return static_cast<std::size_t>(pos) + 1;
+  }
+
+  [[nodiscard]] calc_rep edge(std::size_t i) const noexcept
+  {
+    if (i == 0) return lo_;
+    if (i == count_) return hi_;
+    return std::exp(log_lo_ + log_ratio_ * static_cast<calc_rep>(i));
+  }
+
+  [[nodiscard]] calc_rep interpolate(std::size_t bin, calc_rep fraction) const noexcept
+  {
+    return std::exp(log_lo_ + log_ratio_ * (static_cast<calc_rep>(bin) + fraction));
+  }
+
+  /**
+   * @brief The ratio of the upper and the lower edge of every bin
+   */
+  [[nodiscard]] calc_rep ratio() const noexcept { return std::exp(log_ratio_); }
+
+  [[nodiscard]] friend bool operator==(const log_bins&, const log_bins&) = default;
+
+private:
+  calc_rep lo_;
+  calc_rep hi_;
+  calc_rep log_lo_;
+  calc_rep log_ratio_;
+  calc_rep inv_log_ratio_;
+  std::size_t count_;
+};
+
+/**
+ * @brief A histogram of quantities
+ *
+ * Counts samples in bins defined by `Bins` (`linear_bins` or `log_bins`) plus the underflow and
+ * overflow bins.
+ *
+ * A histogram is meant to be used as a shard owned by a single thread: `record()` must not be
+ * called concurrently with any other operation on the same object. Shards recorded by different
+ * threads can be merged into one aggregate with `merge()`, which is lock-free and can be called
+ * concurrently with other `merge()` calls and with the read-only operations on the aggregate.
+ *
+ * @code{.cpp}
+ * histogram<quantity<si::milli<si::second>>, log_bins<quantity<si::milli<si::second>>>> total({1 * us, 10 * s, 70});
+ * // in every thread
+ * auto shard = total.empty_copy();
+ * for (...) shard.record(latency);
+ * total.merge(shard);
+ * @endcode
+ *
+ * @tparam Q a quantity type of the samples
+ * @tparam Bins the bins of the histogram
+ */
+template<Quantity Q, typename Bins = linear_bins<Q>>
+class histogram {
+  using calc_rep = MP_UNITS_TYPENAME Bins::calc_rep;
+
+public:
+  using value_type = MP_UNITS_TYPENAME Bins::value_type;
+  using bins_type = Bins;
+  using count_type = std::uint64_t;
+
+  explicit histogram(const Bins& bins) :
+      bins_(bins), counts_(std::make_unique<std::atomic<count_type>[]>(bins.size() + 2))
+  {
+  }
+
+  histogram(const histogram& other) : histogram(other.bins_) { merge(other); }
+
+  histogram& operator=(const histogram& other)
+  {
+    if (this != &other) {
+      histogram tmp(other);
+      std::swap(bins_, tmp.bins_);
+      std::swap(counts_, tmp.counts_);
+    }
+    return *this;
+  }
+
+  histogram(histogram&&) noexcept = default;
+  histogram& operator=(histogram&&) noexcept = default;
+
+  /**
+   * @brief Returns a histogram with the same bins and no samples (e.g. a shard for another thread)
+   */
+  [[nodiscard]] histogram empty_copy() const { return histogram(bins_); }
+
+  [[nodiscard]] const bins_type& bins() const noexcept { return bins_; }
+  [[nodiscard]] std::size_t size() const noexcept { return bins_.size(); }
+
+  void record(const Q& x) noexcept { increment(bins_.index(static_cast<calc_rep>(x.numerical_value()))); }
+
+  void record(std::span<const Q> xs) noexcept
+  {
+    for (const Q& x : xs) record(x);
+  }
+
+  /**
+   * @brief Adds the counts of another histogram with the same bins (lock-free)
+   */
+  void merge(const histogram& other)
+  {
+    gsl_Expects(bins_ == other.bins_);
+    for (std::size_t i = 0; i < size() + 2; ++i)
+      if (const count_type c = other.counts_[i].load(std::memory_order_relaxed); c != 0)
+        counts_[i].fetch_add(c, std::memory_order_relaxed);
+  }
+
+  void reset() noexcept
+  {
+    for (std::size_t i = 0; i < size() + 2; ++i) counts_[i].store(0, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] count_type count(std::size_t bin) const
+  {
+    gsl_Expects(bin < size());
+    return counts_[bin + 1].load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] count_type underflow() const noexcept { return counts_[0].load(std::memory_order_relaxed); }
+  [[nodiscard]] count_type overflow() const noexcept { return counts_[size() + 1].load(std::memory_order_relaxed); }
+
+  [[nodiscard]] count_type total() const noexcept
+  {
+    count_type sum = 0;
+    for (std::size_t i = 0; i < size() + 2; ++i) sum += counts_[i].load(std::memory_order_relaxed);
+    return sum;
+  }
+
+  [[nodiscard]] value_type lower_edge(std::size_t bin) const
+  {
+    gsl_Expects(bin < size());
+    return make_quantity<value_type::reference>(bins_.edge(bin));
+  }
+
+  [[nodiscard]] value_type upper_edge(std::size_t bin) const
+  {
+    gsl_Expects(bin < size());
+    return make_quantity<value_type::reference>(bins_.edge(bin + 1));
+  }
+
+  /**
+   * @brief Estimates the `p`-quantile by interpolating within the bin containing it
+   *
+   * Samples in the underflow and overflow bins are assumed to lie on the outer edges of the histogram.
+   */
+  [[nodiscard]] value_type quantile(double p) const
+  {
+    gsl_Expects(0 <= p && p <= 1);
+    const auto [index, fraction] = locate(p);
+    if (index == 0) return make_quantity<value_type::reference>(bins_.edge(0));
+    if (index == size() + 1) return make_quantity<value_type::reference>(bins_.edge(size()));
+    return make_quantity<value_type::reference>(bins_.interpolate(index - 1, fraction));
+  }
+
+  /**
+   * @brief Returns the index in the counts array (including the underflow bin) of the bin containing the `p`-quantile
+   * and the position of the quantile within that bin
+   */
+  [[nodiscard]] std::pair<std::size_t, calc_rep> locate(double p) const
+  {
+    const count_type n = total();
+    gsl_Expects(n > 0);
+    const double rank = p * static_cast<double>(n);
+    count_type cumulative = 0;
+    for (std::size_t i = 0; i < size() + 2; ++i) {
+      const count_type c = counts_[i].load(std::memory_order_relaxed);
+      if (c != 0 && static_cast<double>(cumulative + c) >= rank)
+        return {i, static_cast<calc_rep>((rank - static_cast<double>(cumulative)) / static_cast<double>(c))};
+      cumulative += c;
+    }
+    return {size() + 1, calc_rep{1}};
+  }
+
+private:
+  Bins bins_;
+  std::unique_ptr<std::atomic<count_type>[]> counts_;
+
+  void increment(std::size_t i) noexcept
+  {
+    // only the owning thread records so a plain increment is enough
+    counts_[i].store(counts_[i].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+};
+
+/**
+ * @brief A mergeable quantile sketch with a relative accuracy guarantee (DDSketch)
+ *
+ * Positive values between `min` and `max` are counted in logarithmic bins with the ratio of
+ * `(1 + alpha) / (1 - alpha)`, so every quantile is estimated with a relative error of at most
+ * `alpha`. Values below `min` are reported as `min` and values above `max` as `max`.
+ *
+ * The sketch stores values in the reference of `Q`. It has the same threading guarantees as
+ * `histogram`: record into per-thread shards and merge them into an aggregate with the lock-free
+ * `merge()`.
+ *
+ * @tparam Q a quantity type of the samples
+ */
+template<Quantity Q>
+class quantile_sketch {
+  using bins = log_bins<Q>;
+  using calc_rep = MP_UNITS_TYPENAME bins::calc_rep;
+
+public:
+  using value_type = MP_UNITS_TYPENAME bins::value_type;
+  using count_type = MP_UNITS_TYPENAME histogram<Q, bins>::count_type;
+
+  quantile_sketch(const value_type& min, const value_type& max, double relative_accuracy) :
+      hist_(make_bins(min, max, relative_accuracy)), min_(min), max_(max), alpha_(relative_accuracy)
+  {
+  }
+
+  [[nodiscard]] quantile_sketch empty_copy() const { return quantile_sketch(min_, max_, alpha_); }
+
+  [[nodiscard]] double relative_accuracy() const noexcept { return alpha_; }
+  [[nodiscard]] count_type count() const noexcept { return hist_.total(); }
+
+  void record(const Q& x) noexcept { hist_.record(x); }
+  void record(std::span<const Q> xs) noexcept { hist_.record(xs); }
+
+  /**
+   * @brief Adds the counts of another sketch with the same parameters (lock-free)
+   */
+  void merge(const quantile_sketch& other) { hist_.merge(other.hist_); }
+
+  void reset() noexcept { hist_.reset(); }
+
+  [[nodiscard]] value_type quantile(double p) const
+  {
+    gsl_Expects(0 <= p && p <= 1);
+    const std::size_t index = hist_.locate(p).first;
+    if (index == 0) return min_;
+    if (index == hist_.size() + 1) return max_;
+    // the value with the smallest relative distance to both edges of the bin
+    const calc_rep lower = hist_.bins().edge(index - 1);
+    const calc_rep upper = hist_.bins().edge(index);
+    return std::min(make_quantity<value_type::reference>(2 * lower * upper / (lower + upper)), max_);
+  }
+
+private:
+  histogram<Q, bins> hist_;
+  value_type min_;
+  value_type max_;
+  double alpha_;
+
+  [[nodiscard]] static bins make_bins(const value_type& min, const value_type& max, double alpha)
+  {
+    gsl_Expects(0 < alpha && alpha < 1);
+    gsl_Expects(value_type::zero() < min && min < max);
+    const calc_rep log_gamma = static_cast<calc_rep>(std::log((1 + alpha) / (1 - alpha)));
+    const auto count = static_cast<std::size_t>(std::ceil((std::log(max.numerical_value()) -
+                                                           std::log(min.numerical_value())) /
+                                                          log_gamma));
+    const value_type hi =
+      make_quantity<value_type::reference>(min.numerical_value() * std::exp(log_gamma * static_cast<calc_rep>(count)));
+    return bins(min, hi, std::max<std::size_t>(count, 1));
+  }
+};
+
+}  // namespace mp_units
@@ -0,0 +1,532 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/linear_algebra.h>
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_point.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/units.h>
+#include <mp-units/tensor.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mp_units {
+
+namespace detail {
+
+template<typename T>
+concept QuantityOrQuantityPoint = Quantity<T> || QuantityPoint<T>;
+
+template<Dimension auto... Ds>
+inline constexpr bool are_time_derivatives = false;
+
+template<Dimension auto D>
+inline constexpr bool are_time_derivatives<D> = true;
+
+template<Dimension auto D1, Dimension auto D2, Dimension auto... Ds>
+inline constexpr bool are_time_derivatives<D1, D2, Ds...> =
+  (D1 / D2 == isq::dim_time) && are_time_derivatives<D2, Ds...>;
+
+template<std::size_t I, typename... QQPs>
+using kalman_state_variable = std::tuple_element_t<I, std::tuple<QQPs...>>;
+
+// a value and its consecutive time derivatives, all stored with the same floating-point representation type
+template<typename... QQPs>
+concept KalmanState = (sizeof...(QQPs) > 0) && (QuantityOrQuantityPoint<QQPs> && ...) &&
+                      (std::floating_point<typename QQPs::rep> && ...) &&
+                      (std::same_as<typename QQPs::rep, typename kalman_state_variable<0, QQPs...>::rep> && ...) &&
+                      are_time_derivatives<QQPs::dimension...>;
+
+template<QuantityOrQuantityPoint QQP>
+[[nodiscard]] constexpr typename QQP::rep kalman_value(const QQP& v)
+{
+  if constexpr (Quantity<QQP>)
+    return v.numerical_value();
+  else
+    return v.quantity_from_origin().numerical_value();
+}
+
+template<QuantityOrQuantityPoint QQP>
+[[nodiscard]] constexpr QQP make_kalman_value(typename QQP::rep v)
+{
+  if constexpr (Quantity<QQP>)
+    return make_quantity<QQP::reference>(v);
+  else
+    return make_quantity_point<QQP::point_origin>(make_quantity<QQP::reference>(v));
+}
+
+template<std::size_t N, typename T>
+using kalman_matrix = std::array<std::array<T, N>, N>;
+
+// the factors converting the `J`-th state variable multiplied by `J - I` seconds to the unit of the `I`-th one
+template<typename T, typename... QQPs>
+[[nodiscard]] consteval kalman_matrix<sizeof...(QQPs), T> kalman_unit_factors()
+{
+  constexpr std::size_t n = sizeof...(QQPs);
+  kalman_matrix<n, T> factors{};
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    (
+      [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+        [&]<std::size_t... Js>(std::index_sequence<Js...>) {
+          (
+            [&]<std::size_t J>(std::integral_constant<std::size_t, J>) {
+              if constexpr (J > I) {
+                constexpr auto r =
+                  kalman_state_variable<J, QQPs...>::reference * pow<J - I>(isq::time[si::second]);
+                factors[I][J] = (T{1} * r).numerical_value_in(kalman_state_variable<I, QQPs...>::unit);
+              } else if constexpr (J == I)
+                factors[I][J] = T{1};
+            }(std::integral_constant<std::size_t, Js>{}),
+            ...);
+        }(std::make_index_sequence<n>{});
+      }(std::integral_constant<std::size_t, Is>{}),
+      ...);
+  }(std::make_index_sequence<n>{});
+  return factors;
+}
+
+// the state transition matrix of the constant highest derivative model (the Taylor series of the state
+// truncated after its last derivative) for a time interval of `dt` seconds
+template<typename T, typename... QQPs>
+[[nodiscard]] constexpr kalman_matrix<sizeof...(QQPs), T> kalman_transition(T dt)
+{
+  constexpr std::size_t n = sizeof...(QQPs);
+  constexpr kalman_matrix<n, T> factors = kalman_unit_factors<T, QQPs...>();
+  kalman_matrix<n, T> f{};
+  for (std::size_t i = 0; i < n; ++i) {
+    T term{1};
+    for (std::size_t j = i; j < n; ++j) {
+      f[i][j] = factors[i][j] * term;
+      term = term * dt / static_cast<T>(j - i + 1);
+    }
+  }
+  return f;
+}
+
+// the states and the covariance values of `L` filters where every value is an array over the filters
+template<std::size_t N, typename T, std::size_t L>
+struct kalman_lanes {
+  static constexpr std::size_t covariance_size = N * (N + 1) / 2;
+  std::array<std::array<T, L>, N> x{};
+  std::array<std::array<T, L>, covariance_size> p{};  // in the order of `sym_mat<N, T>::values()`
+
+  [[nodiscard]] friend constexpr bool operator==(const kalman_lanes&, const kalman_lanes&) = default;
+};
+
+template<std::size_t N>
+inline constexpr kalman_matrix<N, std::size_t> kalman_covariance_indices = [] {
+  kalman_matrix<N, std::size_t> indices{};
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t j = 0; j < N; ++j) indices[i][j] = sym_mat<N, double>::index(i, j);
+  return indices;
+}();
+
+// x = F x, P = F P F^T + Q for a single filter
+template<std::size_t N, typename T>
+constexpr void kalman_predict(kalman_lanes<N, T, 1>& s, const kalman_matrix<N, T>& f, const sym_mat<N, T>& q)
+{
+  constexpr auto idx = kalman_covariance_indices<N>;
+
+  std::array<std::array<T, 1>, N> x{};
+  kalman_matrix<N, T> fp{};
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t j = i; j < N; ++j) {
+      x[i][0] += f[i][j] * s.x[j][0];
+      for (std::size_t k = 0; k < N; ++k) fp[i][k] += f[i][j] * s.p[idx[j][k]][0];
+    }
+  s.x = x;
+
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t k = i; k < N; ++k) {
+      T sum = q(i, k);
+      for (std::size_t m = k; m < N; ++m) sum += fp[i][m] * f[k][m];
+      s.p[idx[i][k]][0] = sum;
+    }
+}
+
+// the state transition for a time interval with the covariance transition P -> F P F^T expressed as a matrix
+// acting on the independent values of P, so that both are computed once for all the filters of a batch
+template<std::size_t N, typename T>
+struct kalman_propagation {
+  static constexpr std::size_t covariance_size = N * (N + 1) / 2;
+  kalman_matrix<N, T> state;
+  kalman_matrix<covariance_size, T> covariance;
+};
+
+template<typename T, typename... QQPs>
+[[nodiscard]] constexpr kalman_propagation<sizeof...(QQPs), T> make_kalman_propagation(T dt)
+{
+  constexpr std::size_t n = sizeof...(QQPs);
+  constexpr auto idx = kalman_covariance_indices<n>;
+  kalman_propagation<n, T> prop{kalman_transition<T, QQPs...>(dt), {}};
+  const auto& f = prop.state;
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t k = i; k < n; ++k)
+      for (std::size_t j = i; j < n; ++j)
+        for (std::size_t m = k; m < n; ++m) prop.covariance[idx[i][k]][idx[j][m]] += f[i][j] * f[k][m];
+  return prop;
+}
+
+// x = F x, P = F P F^T + Q for `L` filters at once (the loops over the filters are innermost, so every
+// statement compiles to SIMD instructions)
+template<std::size_t N, typename T, std::size_t L>
+constexpr void kalman_predict(kalman_lanes<N, T, L>& s, const kalman_propagation<N, T>& prop, const sym_mat<N, T>& q)
+{
+  using lanes = std::array<T, L>;
+
+  // the rows are computed in order, as every row depends only on itself and on the rows below it
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t j = i + 1; j < N; ++j)
+      for (std::size_t l = 0; l < L; ++l) s.x[i][l] += prop.state[i][j] * s.x[j][l];
+
+  std::array<lanes, s.covariance_size> p;
+  for (std::size_t a = 0; a < s.covariance_size; ++a) {
+    lanes sum;
+    sum.fill(q.values()[a]);
+    for (std::size_t b = 0; b < s.covariance_size; ++b)
+      for (std::size_t l = 0; l < L; ++l) sum[l] += prop.covariance[a][b] * s.p[b][l];
+    p[a] = sum;
+  }
+  s.p = p;
+}
+
+// the update of `L` filters with measurements `z` of their first state variables having the variance `r`
+// (the measurement matrix H = [1 0 ... 0] reduces the innovation covariance to a single value)
+template<std::size_t N, typename T, std::size_t L>
+constexpr void kalman_update(kalman_lanes<N, T, L>& s, const std::array<T, L>& z, T r)
+{
+  using lanes = std::array<T, L>;
+  constexpr auto idx = kalman_covariance_indices<N>;
+
+  lanes inv_innovation_variance;
+  lanes innovation;
+  for (std::size_t l = 0; l < L; ++l) {
+    inv_innovation_variance[l] = T{1} / (s.p[0][l] + r);
+    innovation[l] = z[l] - s.x[0][l];
+  }
+
+  std::array<lanes, N> row;
+  std::array<lanes, N> gain;
+  for (std::size_t i = 0; i < N; ++i) {
+    row[i] = s.p[idx[0][i]];
+    for (std::size_t l = 0; l < L; ++l) gain[i][l] = row[i][l] * inv_innovation_variance[l];
+  }
+
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t l = 0; l < L; ++l) s.x[i][l] += gain[i][l] * innovation[l];
+    for (std::size_t j = i; j < N; ++j)
+      for (std::size_t l = 0; l < L; ++l) s.p[idx[i][j]][l] -= gain[i][l] * row[j][l];
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief The covariance matrix of a state of a Kalman filter
+ *
+ * The element in the `I`-th row and the `J`-th column is a quantity of the product of the
+ * references of the `I`-th and the `J`-th state variables (e.g. m²/s for the covariance of
+ * a position and a velocity). Only the independent values are stored, expressed in the units of
+ * the state variables.
+ */
+template<detail::QuantityOrQuantityPoint... QQPs>
+  requires detail::KalmanState<QQPs...>
+class kalman_covariance {
+public:
+  using rep = typename detail::kalman_state_variable<0, QQPs...>::rep;
+  static constexpr std::size_t state_size = sizeof...(QQPs);
+
+  template<std::size_t I, std::size_t J>
+  using element_type = quantity<detail::kalman_state_variable<I, QQPs...>::reference *
+                                  detail::kalman_state_variable<J, QQPs...>::reference,
+                                rep>;
+
+  template<std::size_t I>
+  using variance_type = element_type<I, I>;
+
+  kalman_covariance() = default;
+
+  /**
+   * @brief Constructs a diagonal covariance matrix (uncorrelated state variables)
+   */
+  [[nodiscard]] static constexpr kalman_covariance diagonal(
+    const quantity<QQPs::reference * QQPs::reference, rep>&... variances)
+  {
+    return from_values(sym_mat<state_size, rep>::diagonal({variances.numerical_value()...}));
+  }
+
+  /**
+   * @brief The process noise of the piecewise white noise model
+   *
+   * The rate of change of the last state variable (e.g. the acceleration for a position and
+   * a velocity) is assumed to be a random value of the given `variance` that is constant during
+   * every `interval`, which makes all the state variables diverge from the constant highest
+   * derivative model of the state transition.
+   */
+  [[nodiscard]] static constexpr kalman_covariance piecewise_white_noise(
+    QuantityOf<isq::time> auto interval,
+    const quantity<pow<2>(detail::kalman_state_variable<state_size - 1, QQPs...>::reference / isq::time[si::second]),
+                   rep>& variance)
+  {
+    const rep dt = static_cast<rep>(interval.numerical_value_in(si::second));
+    const auto f = detail::kalman_transition<rep, QQPs...>(dt);
+    // the effect of the noise on the `i`-th state variable (dt^(N - i) / (N - i)!)
+    std::array<rep, state_size> g;
+    for (std::size_t i = 0; i < state_size; ++i) g[i] = f[i][state_size - 1] * dt / static_cast<rep>(state_size - i);
+    sym_mat<state_size, rep> q;
+    for (std::size_t i = 0; i < state_size; ++i)
+      for (std::size_t j = i; j < state_size; ++j) q(i, j) = g[i] * g[j] * variance.numerical_value();
+    return from_values(q);
+  }
+
+  /**
+   * @brief Constructs a covariance matrix from its values expressed in the units of the state variables
+   */
+  [[nodiscard]] static constexpr kalman_covariance from_values(const sym_mat<state_size, rep>& values)
+  {
+    kalman_covariance c;
+    c.values_ = values;
+    return c;
+  }
+
+  template<std::size_t I, std::size_t J>
+    requires(I < state_size) && (J < state_size)
+  [[nodiscard]] constexpr element_type<I, J> get() const
+  {
+    return make_quantity<element_type<I, J>::reference>(values_(I, J));
+  }
+
+  template<std::size_t I, std::size_t J>
+    requires(I < state_size) && (J < state_size)
+  constexpr void set(const element_type<I, J>& v)
+  {
+    values_(I, J) = v.numerical_value();
+  }
+
+  /**
+   * @brief The values expressed in the units of the state variables
+   */
+  [[nodiscard]] constexpr const sym_mat<state_size, rep>& values() const { return values_; }
+
+  [[nodiscard]] friend constexpr bool operator==(const kalman_covariance&, const kalman_covariance&) = default;
+
+private:
+  sym_mat<state_size, rep> values_;
+};
+
+template<detail::QuantityOrQuantityPoint... QQPs>
+  requires detail::KalmanState<QQPs...>
+class kalman_filters;
+
+/**
+ * @brief A linear Kalman filter of a value and its consecutive time derivatives
+ *
+ * The state (e.g. a position, a velocity, and an acceleration) is propagated with the constant
+ * highest derivative model and updated with measurements of its first variable. The state and its
+ * covariance are stored as numerical values in fixed-size arrays, so neither the construction nor
+ * the `predict()` and `update()` steps allocate.
+ */
+template<detail::QuantityOrQuantityPoint... QQPs>
+  requires detail::KalmanState<QQPs...>
+class kalman_filter {
+public:
+  using rep = typename detail::kalman_state_variable<0, QQPs...>::rep;
+  using state_type = std::tuple<QQPs...>;
+  using covariance_type = kalman_covariance<QQPs...>;
+  using measurement_type = detail::kalman_state_variable<0, QQPs...>;
+  using measurement_variance_type = typename covariance_type::template variance_type<0>;
+  static constexpr std::size_t state_size = sizeof...(QQPs);
+
+  kalman_filter() = default;
+
+  constexpr kalman_filter(const state_type& state, const covariance_type& covariance)
+  {
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((values_.x[Is][0] = detail::kalman_value(std::get<Is>(state))), ...);
+    }(std::make_index_sequence<state_size>{});
+    for (std::size_t k = 0; k < values_.covariance_size; ++k) values_.p[k][0] = covariance.values().values()[k];
+  }
+
+  template<std::size_t I>
+    requires(I < state_size)
+  [[nodiscard]] constexpr detail::kalman_state_variable<I, QQPs...> get() const
+  {
+    return detail::make_kalman_value<detail::kalman_state_variable<I, QQPs...>>(values_.x[I][0]);
+  }
+
+  [[nodiscard]] constexpr state_type state() const
+  {
+    return [this]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return state_type{get<Is>()...};
+    }(std::make_index_sequence<state_size>{});
+  }
+
+  [[nodiscard]] constexpr covariance_type covariance() const
+  {
+    typename sym_mat<state_size, rep>::storage_type p;
+    for (std::size_t k = 0; k < values_.covariance_size; ++k) p[k] = values_.p[k][0];
+    return covariance_type::from_values(sym_mat<state_size, rep>::from_values(p));
+  }
+
+  /**
+   * @brief Propagates the state and its covariance by the given time `interval`
+   */
+  constexpr void predict(QuantityOf<isq::time> auto interval, const covariance_type& process_noise)
+  {
+    const auto f = detail::kalman_transition<rep, QQPs...>(static_cast<rep>(interval.numerical_value_in(si::second)));
+    detail::kalman_predict(values_, f, process_noise.values());
+  }
+
+  /**
+   * @brief Corrects the state with a measurement of its first variable
+   */
+  constexpr void update(const measurement_type& measured, const measurement_variance_type& variance)
+  {
+    gsl_Expects(variance.numerical_value() >= 0);
+    detail::kalman_update(values_, {detail::kalman_value(measured)}, variance.numerical_value());
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const kalman_filter&, const kalman_filter&) = default;
+
+private:
+  detail::kalman_lanes<state_size, rep, 1> values_;
+
+  friend class kalman_filters<QQPs...>;
+};
+
+template<detail::QuantityOrQuantityPoint... QQPs>
+kalman_filter(std::tuple<QQPs...>, kalman_covariance<QQPs...>) -> kalman_filter<QQPs...>;
+
+/**
+ * @brief Many independent Kalman filters of the same state propagated and updated together
+ *
+ * The filters are stored in blocks of `lanes` filters where every value of the state and of the
+ * covariance is a separate array over the filters of a block (a structure of arrays per block).
+ * `predict()` and `update()` run the filter equations once per block on whole arrays, so the
+ * compiler vectorizes them across the filters, and no conversions or allocations are done in
+ * these steps.
+ */
+template<detail::QuantityOrQuantityPoint... QQPs>
+  requires detail::KalmanState<QQPs...>
+class kalman_filters {
+public:
+  using value_type = kalman_filter<QQPs...>;
+  using rep = typename value_type::rep;
+  using covariance_type = typename value_type::covariance_type;
+  using measurement_type = typename value_type::measurement_type;
+  using measurement_variance_type = typename value_type::measurement_variance_type;
+  static constexpr std::size_t state_size = sizeof...(QQPs);
+  static constexpr std::size_t lanes = std::max<std::size_t>(detail::simd_width / sizeof(rep), 1);
+
+  kalman_filters() = default;
+
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  void reserve(std::size_t size) { blocks_.reserve((size + lanes - 1) / lanes); }
+
+  void clear()
+  {
+    blocks_.clear();
+    size_ = 0;
+  }
+
+  void push_back(const value_type& filter)
+  {
+    if (size_ % lanes == 0) blocks_.emplace_back();
+    ++size_;
+    set(size_ - 1, filter);
+  }
+
+  [[nodiscard]] value_type operator[](std::size_t i) const
+  {
+    gsl_Expects(i < size_);
+    const block& b = blocks_[i / lanes];
+    const std::size_t lane = i % lanes;
+    value_type filter;
+    for (std::size_t k = 0; k < state_size; ++k) filter.values_.x[k][0] = b.x[k][lane];
+    for (std::size_t k = 0; k < b.covariance_size; ++k) filter.values_.p[k][0] = b.p[k][lane];
+    return filter;
+  }
+
+  void set(std::size_t i, const value_type& filter)
+  {
+    gsl_Expects(i < size_);
+    block& b = blocks_[i / lanes];
+    const std::size_t lane = i % lanes;
+    for (std::size_t k = 0; k < state_size; ++k) b.x[k][lane] = filter.values_.x[k][0];
+    for (std::size_t k = 0; k < b.covariance_size; ++k) b.p[k][lane] = filter.values_.p[k][0];
+  }
+
+  /**
+   * @brief Propagates the states of all the filters by the same time `interval`
+   */
+  void predict(QuantityOf<isq::time> auto interval, const covariance_type& process_noise)
+  {
+    const auto prop =
+      detail::make_kalman_propagation<rep, QQPs...>(static_cast<rep>(interval.numerical_value_in(si::second)));
+    for (block& b : blocks_) detail::kalman_predict(b, prop, process_noise.values());
+  }
+
+  /**
+   * @brief Corrects the states of all the filters with their measurements
+   *
+   * @note `measured` must provide a measurement for every filter.
+   */
+  void update(std::span<const measurement_type> measured, const measurement_variance_type& variance)
+  {
+    gsl_Expects(measured.size() == size_);
+    gsl_Expects(variance.numerical_value() >= 0);
+    const rep r = variance.numerical_value();
+    const std::size_t full = size_ / lanes;
+    for (std::size_t i = 0; i < full; ++i) {
+      std::array<rep, lanes> z;
+      for (std::size_t l = 0; l < lanes; ++l) z[l] = detail::kalman_value(measured[i * lanes + l]);
+      detail::kalman_update(blocks_[i], z, r);
+    }
+    if (full < blocks_.size()) {
+      // the unused lanes of the last block get a zero innovation
+      block& b = blocks_.back();
+      std::array<rep, lanes> z = b.x[0];
+      for (std::size_t l = 0; l < size_ - full * lanes; ++l) z[l] = detail::kalman_value(measured[full * lanes + l]);
+      detail::kalman_update(b, z, r);
+    }
+  }
+
+private:
+  using block = detail::kalman_lanes<state_size, rep, lanes>;
+
+  std::vector<block> blocks_;
+  std::size_t size_ = 0;
+};
+
+}  // namespace mp_units
@@ -0,0 +1,489 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/customization_points.h>
+#include <mp-units/quantity.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace mp_units {
+
+namespace detail {
+
+// the width of the widest commonly available SIMD registers (AVX)
+inline constexpr std::size_t simd_width = 32;
+
+/**
+ * @brief The number of elements a fixed-size vector of `n` values of `T` is stored in
+ *
+ * Short vectors are padded to a power of two (e.g. 3 to 4) and longer ones to a multiple of the
+ * SIMD register width so that every operation on them maps to whole SIMD registers.
+ */
+template<typename T>
+[[nodiscard]] consteval std::size_t simd_padded_size(std::size_t n)
+{
+  constexpr std::size_t lanes = std::max<std::size_t>(simd_width / sizeof(T), 1);
+  return n < lanes ? std::bit_ceil(n) : (n + lanes - 1) / lanes * lanes;
+}
+
+template<typename From, typename To>
+concept NonNarrowingConvertible = requires(From from) { To{from}; };
+
+}  // namespace detail
+
+/**
+ * @brief A fixed-size vector of `N` values of an arithmetic type
+ *
+ * Satisfies `is_vector`, so it can be used as a representation type of vector quantities.
+ * The values are stored in an aligned array padded with zeros to the SIMD register size
+ * (e.g. `vec<3, double>` takes 32 bytes), so the element-wise operations compile to whole
+ * SIMD instructions without any remainder handling.
+ */
+template<std::size_t N, typename T>
+  requires(N > 0) && std::is_arithmetic_v<T> && (!std::same_as<T, bool>)
+class vec {
+public:
+  using value_type = T;
+  static constexpr std::size_t padded_size = detail::simd_padded_size<T>(N);
+
+  [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+
+  vec() = default;
+
+  template<typename... Ts>
+    requires(sizeof...(Ts) == N) && (std::convertible_to<Ts, T> && ...)
+  constexpr vec(Ts... values) : data_{static_cast<T>(values)...}
+  {
+  }
+
+  template<typename U>
+    requires(!std::same_as<U, T>) && std::convertible_to<U, T>
+  constexpr explicit(!detail::NonNarrowingConvertible<U, T>) vec(const vec<N, U>& other)
+  {
+    for (std::size_t i = 0; i < N; ++i) data_[i] = static_cast<T>(other[i]);
+  }
+
+  [[nodiscard]] constexpr T& operator[](std::size_t i) { return data_[i]; }
+  [[nodiscard]] constexpr const T& operator[](std::size_t i) const { return data_[i]; }
+  [[nodiscard]] constexpr T& operator()(std::size_t i) { return data_[i]; }
+  [[nodiscard]] constexpr const T& operator()(std::size_t i) const { return data_[i]; }
+
+  [[nodiscard]] constexpr T* data() noexcept { return data_; }
+  [[nodiscard]] constexpr const T* data() const noexcept { return data_; }
+  [[nodiscard]] constexpr T* begin() noexcept { return data_; }
+  [[nodiscard]] constexpr const T* begin() const noexcept { return data_; }
+  [[nodiscard]] constexpr T* end() noexcept { return data_ + N; }
+  [[nodiscard]] constexpr const T* end() const noexcept { return data_ + N; }
+
+  [[nodiscard]] constexpr vec operator+() const { return *this; }
+  [[nodiscard]] constexpr vec operator-() const
+    requires std::is_signed_v<T>
+  {
+    vec r;
+    for (std::size_t i = 0; i < padded_size; ++i) r.data_[i] = static_cast<T>(-data_[i]);
+    return r;
+  }
+
+  constexpr vec& operator+=(const vec& other)
+  {
+    for (std::size_t i = 0; i < padded_size; ++i) data_[i] += other.data_[i];
+    return *this;
+  }
+
+  constexpr vec& operator-=(const vec& other)
+  {
+    for (std::size_t i = 0; i < padded_size; ++i) data_[i] -= other.data_[i];
+    return *this;
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  constexpr vec& operator*=(const S& s)
+  {
+    for (std::size_t i = 0; i < padded_size; ++i) data_[i] = static_cast<T>(data_[i] * s);
+    return *this;
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  constexpr vec& operator/=(const S& s)
+  {
+    // the padding is not divided to keep it zero even for a zero divisor
+    for (std::size_t i = 0; i < N; ++i) data_[i] = static_cast<T>(data_[i] / s);
+    return *this;
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator+(const vec& lhs, const vec<N, U>& rhs)
+  {
+    return detail_apply(lhs, rhs, std::plus<>{});
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator-(const vec& lhs, const vec<N, U>& rhs)
+  {
+    return detail_apply(lhs, rhs, std::minus<>{});
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  [[nodiscard]] friend constexpr auto operator*(const vec& v, const S& s)
+  {
+    vec<N, decltype(T{} * S{})> r;
+    for (std::size_t i = 0; i < std::min(padded_size, r.padded_size); ++i) r.data()[i] = v.data_[i] * s;
+    return r;
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  [[nodiscard]] friend constexpr auto operator*(const S& s, const vec& v)
+  {
+    return v * s;
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  [[nodiscard]] friend constexpr auto operator/(const vec& v, const S& s)
+  {
+    vec<N, decltype(T{} / S{})> r;
+    for (std::size_t i = 0; i < N; ++i) r[i] = v.data_[i] / s;
+    return r;
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr bool operator==(const vec& lhs, const vec<N, U>& rhs)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+      if (lhs[i] != rhs[i]) return false;
+    return true;
+  }
+
+private:
+  alignas(std::max(padded_size * sizeof(T) < detail::simd_width ? padded_size * sizeof(T) : detail::simd_width,
+                   alignof(T))) T data_[padded_size]{};
+
+  template<typename U, typename Op>
+  [[nodiscard]] static constexpr auto detail_apply(const vec& lhs, const vec<N, U>& rhs, Op op)
+  {
+    vec<N, decltype(op(T{}, U{}))> r;
+    // the padding of both vectors is zero so it may be processed as well if the layouts match
+    constexpr std::size_t count = padded_size == vec<N, U>::padded_size ? padded_size : N;
+    for (std::size_t i = 0; i < std::min(count, r.padded_size); ++i) r.data()[i] = op(lhs.data_[i], rhs.data()[i]);
+    return r;
+  }
+};
+
+template<typename T, typename... Ts>
+vec(T, Ts...) -> vec<1 + sizeof...(Ts), std::common_type_t<T, Ts...>>;
+
+template<std::size_t N, typename T>
+inline constexpr bool is_vector<vec<N, T>> = true;
+
+/**
+ * @brief The scalar (dot) product of two vectors
+ */
+template<std::size_t N, typename T, typename U>
+[[nodiscard]] constexpr auto dot(const vec<N, T>& lhs, const vec<N, U>& rhs)
+{
+  decltype(T{} * U{}) r{};
+  for (std::size_t i = 0; i < N; ++i) r += lhs[i] * rhs[i];
+  return r;
+}
+
+/**
+ * @brief The vector (cross) product of two 3-dimensional vectors
+ */
+template<typename T, typename U>
+[[nodiscard]] constexpr auto cross(const vec<3, T>& lhs, const vec<3, U>& rhs)
+{
+  return vec<3, decltype(T{} * U{})>{lhs[1] * rhs[2] - lhs[2] * rhs[1], lhs[2] * rhs[0] - lhs[0] * rhs[2],
+                                     lhs[0] * rhs[1] - lhs[1] * rhs[0]};
+}
+
+/**
+ * @brief The Euclidean norm (magnitude) of a vector
+ */
+template<std::size_t N, typename T>
+[[nodiscard]] auto norm(const vec<N, T>& v)
+{
+  using std::sqrt;
+  return sqrt(dot(v, v));
+}
+
+/**
+ * @brief A fixed-size `R` x `C` matrix of values of an arithmetic type
+ *
+ * Satisfies `is_tensor`, so it can be used as a representation type of tensor quantities.
+ * The values are stored in columns of `vec<R, T>`, so a matrix-vector product is a sum of
+ * whole-column SIMD multiplications.
+ */
+template<std::size_t R, std::size_t C, typename T>
+  requires(R > 0) && (C > 0) && std::is_arithmetic_v<T> && (!std::same_as<T, bool>)
+class mat {
+public:
+  using value_type = T;
+  using column_type = vec<R, T>;
+  using row_type = vec<C, T>;
+
+  [[nodiscard]] static constexpr std::size_t rows() noexcept { return R; }
+  [[nodiscard]] static constexpr std::size_t cols() noexcept { return C; }
+
+  mat() = default;
+
+  /**
+   * @brief Constructs a matrix from its rows, e.g. `mat<2, 2, double>{{1, 2}, {3, 4}}`
+   */
+  constexpr mat(std::initializer_list<row_type> rows)
+  {
+    gsl_Expects(rows.size() == R);
+    std::size_t i = 0;
+    for (const row_type& row : rows) {
+      for (std::size_t j = 0; j < C; ++j) cols_[j][i] = row[j];
+      ++i;
+    }
+  }
+
+  template<typename U>
+    requires(!std::same_as<U, T>) && std::convertible_to<U, T>
+  constexpr explicit(!detail::NonNarrowingConvertible<U, T>) mat(const mat<R, C, U>& other)
+  {
+    for (std::size_t j = 0; j < C; ++j) cols_[j] = column_type(other.col(j));
+  }
+
+  [[nodiscard]] static constexpr mat identity()
+    requires(R == C)
+  {
+    mat m;
+    for (std::size_t i = 0; i < R; ++i) m(i, i) = T{1};
+    return m;
+  }
+
+  [[nodiscard]] constexpr T& operator()(std::size_t i, std::size_t j) { return cols_[j][i]; }
+  [[nodiscard]] constexpr const T& operator()(std::size_t i, std::size_t j) const { return cols_[j][i]; }
+
+  [[nodiscard]] constexpr const column_type& col(std::size_t j) const { return cols_[j]; }
+  [[nodiscard]] constexpr row_type row(std::size_t i) const
+  {
+    row_type r;
+    for (std::size_t j = 0; j < C; ++j) r[j] = cols_[j][i];
+    return r;
+  }
+
+  [[nodiscard]] constexpr mat operator+() const { return *this; }
+  [[nodiscard]] constexpr mat operator-() const
+    requires std::is_signed_v<T>
+  {
+    mat m;
+    for (std::size_t j = 0; j < C; ++j) m.cols_[j] = -cols_[j];
+    return m;
+  }
+
+  constexpr mat& operator+=(const mat& other)
+  {
+    for (std::size_t j = 0; j < C; ++j) cols_[j] += other.cols_[j];
+    return *this;
+  }
+
+  constexpr mat& operator-=(const mat& other)
+  {
+    for (std::size_t j = 0; j < C; ++j) cols_[j] -= other.cols_[j];
+    return *this;
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  constexpr mat& operator*=(const S& s)
+  {
+    for (auto& c : cols_) c *= s;
+    return *this;
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  constexpr mat& operator/=(const S& s)
+  {
+    for (auto& c : cols_) c /= s;
+    return *this;
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator+(const mat& lhs, const mat<R, C, U>& rhs)
+  {
+    return lhs.apply([&](std::size_t j) { return lhs.cols_[j] + rhs.col(j); });
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator-(const mat& lhs, const mat<R, C, U>& rhs)
+  {
+    return lhs.apply([&](std::size_t j) { return lhs.cols_[j] - rhs.col(j); });
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  [[nodiscard]] friend constexpr auto operator*(const mat& m, const S& s)
+  {
+    return m.apply([&](std::size_t j) { return m.cols_[j] * s; });
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  [[nodiscard]] friend constexpr auto operator*(const S& s, const mat& m)
+  {
+    return m * s;
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  [[nodiscard]] friend constexpr auto operator/(const mat& m, const S& s)
+  {
+    return m.apply([&](std::size_t j) { return m.cols_[j] / s; });
+  }
+
+  /**
+   * @brief The matrix-vector product computed as a linear combination of the columns
+   */
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator*(const mat& m, const vec<C, U>& v)
+  {
+    auto r = m.cols_[0] * v[0];
+    for (std::size_t j = 1; j < C; ++j) r += m.cols_[j] * v[j];
+    return r;
+  }
+
+  /**
+   * @brief The product of a row vector and a matrix (i.e. `transpose(m) * v`)
+   */
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator*(const vec<R, U>& v, const mat& m)
+  {
+    vec<C, decltype(U{} * T{})> r;
+    for (std::size_t j = 0; j < C; ++j) r[j] = dot(v, m.cols_[j]);
+    return r;
+  }
+
+  template<std::size_t K, typename U>
+  [[nodiscard]] friend constexpr auto operator*(const mat& lhs, const mat<C, K, U>& rhs)
+  {
+    mat<R, K, decltype(T{} * U{})> r;
+    for (std::size_t k = 0; k < K; ++k) {
+      const auto c = lhs * rhs.col(k);
+      for (std::size_t i = 0; i < R; ++i) r(i, k) = c[i];
+    }
+    return r;
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr bool operator==(const mat& lhs, const mat<R, C, U>& rhs)
+  {
+    for (std::size_t j = 0; j < C; ++j)
+      if (lhs.cols_[j] != rhs.col(j)) return false;
+    return true;
+  }
+
+private:
+  std::array<column_type, C> cols_{};
+
+  template<typename F>
+  [[nodiscard]] constexpr auto apply(F f) const
+  {
+    using column = decltype(f(0));
+    mat<R, C, typename column::value_type> m;
+    for (std::size_t j = 0; j < C; ++j) {
+      const column c = f(j);
+      for (std::size_t i = 0; i < R; ++i) m(i, j) = c[i];
+    }
+    return m;
+  }
+};
+
+template<std::size_t R, std::size_t C, typename T>
+inline constexpr bool is_tensor<mat<R, C, T>> = true;
+
+template<std::size_t R, std::size_t C, typename T>
+[[nodiscard]] constexpr mat<C, R, T> transpose(const mat<R, C, T>& m)
+{
+  mat<C, R, T> t;
+  for (std::size_t i = 0; i < R; ++i)
+    for (std::size_t j = 0; j < C; ++j) t(j, i) = m(i, j);
+  return t;
+}
+
+/**
+ * @brief The scalar product of two vector quantities
+ *
+ * The result is a scalar quantity of the product of their units (e.g. `N * m` for a force
+ * and a displacement), which converts implicitly to the matching scalar quantity like
+ * `isq::mechanical_work`.
+ */
+template<Quantity Q1, Quantity Q2>
+  requires requires(const typename Q1::rep& v1, const typename Q2::rep& v2) { dot(v1, v2); }
+[[nodiscard]] constexpr Quantity auto dot(const Q1& q1, const Q2& q2)
+{
+  return dot(q1.numerical_value(), q2.numerical_value()) * (Q1::unit * Q2::unit);
+}
+
+/**
+ * @brief The vector product of two vector quantities
+ *
+ * The result is a vector quantity of the product of their quantity specifications
+ * (e.g. `isq::position_vector * isq::force` that converts to `isq::moment_of_force`).
+ */
+template<Quantity Q1, Quantity Q2>
+  requires requires(const typename Q1::rep& v1, const typename Q2::rep& v2) { cross(v1, v2); }
+[[nodiscard]] constexpr Quantity auto cross(const Q1& q1, const Q2& q2)
+{
+  return cross(q1.numerical_value(), q2.numerical_value()) * (Q1::reference * Q2::reference);
+}
+
+/**
+ * @brief The magnitude of a vector quantity
+ *
+ * The result is a scalar quantity of the same unit (e.g. a speed for a velocity).
+ */
+template<Quantity Q>
+  requires requires(const typename Q::rep& v) { norm(v); }
+[[nodiscard]] Quantity auto norm(const Q& q)
+{
+  return norm(q.numerical_value()) * Q::unit;
+}
+
+}  // namespace mp_units
+
+template<std::size_t N, typename T, typename U>
+struct std::common_type<mp_units::vec<N, T>, mp_units::vec<N, U>> {
+  using type = mp_units::vec<N, std::common_type_t<T, U>>;
+};
+
+template<std::size_t R, std::size_t C, typename T, typename U>
+struct std::common_type<mp_units::mat<R, C, T>, mp_units::mat<R, C, U>> {
+  using type = mp_units::mat<R, C, std::common_type_t<T, U>>;
+};
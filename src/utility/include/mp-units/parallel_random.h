@@ -0,0 +1,208 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/quantity.h>
+#include <mp-units/random.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace mp_units {
+
+/**
+ * @brief Philox4x32-10 counter-based random number engine
+ *
+ * Every output is a function of the seed and of its position in the stream (J. K. Salmon et al.,
+ * "Parallel random numbers: as easy as 1, 2, 3", SC'11), so the engine can jump to any position in
+ * O(1) and split into independent streams and substreams without any state shared between them.
+ *
+ * The 128-bit counter consists of the 64-bit position, the 32-bit stream, and the 32-bit
+ * substream numbers; the seed is the 64-bit key.
+ */
+class philox4x32 {
+public:
+  using result_type = std::uint32_t;
+
+  static constexpr std::uint64_t default_seed = 20111115u;
+
+  [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+  [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+  constexpr philox4x32() noexcept : philox4x32(default_seed) {}
+
+  constexpr explicit philox4x32(std::uint64_t seed, std::uint32_t stream = 0, std::uint32_t substream = 0) noexcept :
+      key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)},
+      stream_(stream),
+      substream_(substream)
+  {
+  }
+
+  constexpr void seed(std::uint64_t value = default_seed) noexcept { *this = philox4x32(value, stream_, substream_); }
+
+  [[nodiscard]] constexpr std::uint64_t get_seed() const noexcept
+  {
+    return static_cast<std::uint64_t>(key_[1]) << 32 | key_[0];
+  }
+
+  [[nodiscard]] constexpr std::uint32_t stream() const noexcept { return stream_; }
+  [[nodiscard]] constexpr std::uint32_t substream() const noexcept { return substream_; }
+
+  /**
+   * @brief The number of values generated since the beginning of the (sub)stream
+   */
+  [[nodiscard]] constexpr std::uint64_t position() const noexcept { return position_; }
+
+  /**
+   * @brief Returns an engine at the beginning of another stream with the same seed
+   */
+  [[nodiscard]] constexpr philox4x32 split(std::uint32_t stream) const noexcept
+  {
+    return philox4x32(get_seed(), stream, 0);
+  }
+
+  /**
+   * @brief Returns an engine at the beginning of another substream of the current stream
+   */
+  [[nodiscard]] constexpr philox4x32 split_substream(std::uint32_t substream) const noexcept
+  {
+    return philox4x32(get_seed(), stream_, substream);
+  }
+
+  constexpr result_type operator()() noexcept
+  {
+    if (position_ % 4 == 0) buffer_ = block(position_ / 4);
+    return buffer_[position_++ % 4];
+  }
+
+  constexpr void discard(unsigned long long z) noexcept { seek(position_ + z); }
+
+  /**
+   * @brief Moves to the given position in the current (sub)stream
+   */
+  constexpr void seek(std::uint64_t position) noexcept
+  {
+    position_ = position;
+    if (position_ % 4 != 0) buffer_ = block(position_ / 4);
+  }
+
+  /**
+   * @brief The Philox4x32-10 bijection of a counter with a key
+   */
+  [[nodiscard]] static constexpr std::array<std::uint32_t, 4> bijection(std::array<std::uint32_t, 4> ctr,
+                                                                        std::array<std::uint32_t, 2> key) noexcept
+  {
+    constexpr std::uint64_t m0 = 0xD2511F53;
+    constexpr std::uint64_t m1 = 0xCD9E8D57;
+    for (int round = 0; round < 10; ++round) {
+      if (round > 0) {
+        key[0] += 0x9E3779B9;
+        key[1] += 0xBB67AE85;
+      }
+      const std::uint64_t p0 = m0 * ctr[0];
+      const std::uint64_t p1 = m1 * ctr[2];
+      ctr = {static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<std::uint32_t>(p1),
+             static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<std::uint32_t>(p0)};
+    }
+    return ctr;
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const philox4x32& lhs, const philox4x32& rhs) noexcept
+  {
+    return lhs.key_ == rhs.key_ && lhs.stream_ == rhs.stream_ && lhs.substream_ == rhs.substream_ &&
+           lhs.position_ == rhs.position_;
+  }
+
+private:
+  std::array<std::uint32_t, 2> key_;
+  std::uint32_t stream_;
+  std::uint32_t substream_;
+  std::uint64_t position_ = 0;
+  std::array<std::uint32_t, 4> buffer_{};
+
+  [[nodiscard]] constexpr std::array<std::uint32_t, 4> block(std::uint64_t index) const noexcept
+  {
+    return bijection({static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(index >> 32), stream_, substream_},
+                     key_);
+  }
+};
+
+namespace detail {
+
+/**
+ * @brief Calls `f(i, offset, count)` for every chunk `i` of `size` elements using many threads
+ *
+ * The chunks are `chunk_size` elements long (apart from the last one) and are distributed
+ * dynamically between at most `threads` threads, the calling thread being one of them.
+ */
+template<typename F>
+void parallel_for_chunks(std::size_t size, std::size_t chunk_size, unsigned threads, F f)
+{
+  gsl_Expects(chunk_size > 0);
+  const std::size_t chunks = (size + chunk_size - 1) / chunk_size;
+  std::atomic<std::size_t> next{0};
+  auto worker = [&] {
+    for (std::size_t i = next.fetch_add(1, std::memory_order_relaxed); i < chunks;
+         i = next.fetch_add(1, std::memory_order_relaxed)) {
+      const std::size_t offset = i * chunk_size;
+      f(i, offset, std::min(chunk_size, size - offset));
+    }
+  };
+
+  const std::size_t count = std::min<std::size_t>(std::max(threads, 1u), chunks);
+  std::vector<std::thread> workers;
+  for (std::size_t i = 1; i < count; ++i) workers.emplace_back(worker);
+  worker();
+  for (auto& w : workers) w.join();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Fills `out` with samples of `dist` using many threads
+ *
+ * `out` is divided into chunks of `chunk_size` values and the chunk `i` is filled by the bulk
+ * `generate()` of a copy of `dist` with `engine.split_substream(i)`. The result depends only on
+ * `dist`, `engine`, and `chunk_size`, so it is bit-identical for any number of threads.
+ */
+template<typename Distribution, Quantity Q>
+void parallel_generate(const Distribution& dist, const philox4x32& engine, std::span<Q> out,
+                       unsigned threads = std::thread::hardware_concurrency(), std::size_t chunk_size = 16384)
+{
+  gsl_Expects(chunk_size > 0);
+  gsl_Expects(out.size() / chunk_size < std::numeric_limits<std::uint32_t>::max());
+  detail::parallel_for_chunks(out.size(), chunk_size, threads, [&](std::size_t i, std::size_t offset, std::size_t n) {
+    Distribution d = dist;
+    auto gen = engine.split_substream(static_cast<std::uint32_t>(i));
+    d.generate(gen, out.subspan(offset, n));
+  });
+}
+
+}  // namespace mp_units
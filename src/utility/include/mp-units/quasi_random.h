@@ -0,0 +1,465 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/parallel_random.h>
+#include <mp-units/quantity.h>
+#include <mp-units/random.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace mp_units {
+
+namespace detail {
+
+struct sobol_polynomial {
+  unsigned degree;
+  std::uint32_t coefficients;
+  std::array<std::uint32_t, 7> initial_numbers;
+};
+
+// primitive polynomials and initial direction numbers of the dimensions 2 to 21
+// (S. Joe and F. Y. Kuo, "Constructing Sobol sequences with better two-dimensional projections", 2008)
+inline constexpr std::array<sobol_polynomial, 20> sobol_polynomials = {{
+  {1, 0, {1}},
+  {2, 1, {1, 3}},
+  {3, 1, {1, 3, 1}},
+  {3, 2, {1, 1, 1}},
+  {4, 1, {1, 1, 3, 3}},
+  {4, 4, {1, 3, 5, 13}},
+  {5, 2, {1, 1, 5, 5, 17}},
+  {5, 4, {1, 1, 5, 5, 5}},
+  {5, 7, {1, 1, 7, 11, 19}},
+  {5, 11, {1, 1, 5, 1, 1}},
+  {5, 13, {1, 1, 1, 3, 11}},
+  {5, 14, {1, 3, 5, 5, 31}},
+  {6, 1, {1, 3, 3, 9, 7, 49}},
+  {6, 13, {1, 1, 1, 15, 21, 21}},
+  {6, 16, {1, 3, 1, 13, 27, 49}},
+  {6, 19, {1, 1, 1, 15, 7, 5}},
+  {6, 22, {1, 3, 1, 15, 13, 25}},
+  {6, 25, {1, 1, 5, 5, 19, 61}},
+  {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+  {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+}};
+
+inline constexpr std::size_t sobol_bits = 32;
+
+[[nodiscard]] constexpr std::array<std::uint32_t, sobol_bits> sobol_directions(std::size_t dimension)
+{
+  std::array<std::uint32_t, sobol_bits> v{};
+  if (dimension == 0) {
+    for (std::size_t k = 0; k < sobol_bits; ++k) v[k] = std::uint32_t{1} << (sobol_bits - 1 - k);
+    return v;
+  }
+  const auto& p = sobol_polynomials[dimension - 1];
+  const std::size_t s = p.degree;
+  for (std::size_t k = 0; k < s; ++k) v[k] = p.initial_numbers[k] << (sobol_bits - 1 - k);
+  for (std::size_t k = s; k < sobol_bits; ++k) {
+    v[k] = v[k - s] ^ (v[k - s] >> s);
+    for (std::size_t j = 1; j < s; ++j)
+      if ((p.coefficients >> (s - 1 - j)) & 1) v[k] ^= v[k - j];
+  }
+  return v;
+}
+
+inline constexpr std::array<std::uint32_t, 32> halton_bases = {2,  3,  5,  7,  11, 13, 17, 19, 23, 29,  31,
+                                                               37, 41, 43, 47, 53, 59, 61, 67, 71, 73,  79,
+                                                               83, 89, 97, 101, 103, 107, 109, 113, 127, 131};
+
+/**
+ * @brief Maps points of the unit hypercube onto the product of ranges of quantities
+ */
+template<Quantity... Qs>
+  requires(treat_as_floating_point<typename Qs::rep> && ...)
+class quantity_box {
+public:
+  quantity_box(std::pair<Qs, Qs>... ranges) : min_(ranges.first...), width_((ranges.second - ranges.first)...) {}
+
+  [[nodiscard]] std::tuple<Qs...> min() const { return min_; }
+  [[nodiscard]] std::tuple<Qs...> max() const
+  {
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return std::tuple<Qs...>(std::get<Is>(min_) + std::get<Is>(width_)...);
+    }(std::index_sequence_for<Qs...>{});
+  }
+
+  template<std::size_t I>
+  [[nodiscard]] std::tuple_element_t<I, std::tuple<Qs...>> map(double u) const
+  {
+    using Q = std::tuple_element_t<I, std::tuple<Qs...>>;
+    return std::get<I>(min_) + static_cast<MP_UNITS_TYPENAME Q::rep>(u) * std::get<I>(width_);
+  }
+
+  [[nodiscard]] std::tuple<Qs...> map(const std::array<double, sizeof...(Qs)>& u) const
+  {
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return std::tuple<Qs...>(map<Is>(u[Is])...);
+    }(std::index_sequence_for<Qs...>{});
+  }
+
+private:
+  std::tuple<Qs...> min_;
+  std::tuple<Qs...> width_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief The Sobol low-discrepancy sequence in the `Dims`-dimensional unit hypercube
+ *
+ * Produces the points in the Gray code order (I. A. Antonov and V. M. Saleev, 1979), so every
+ * point costs a single XOR per dimension, and any point can be reached in O(log(index)). The
+ * first 2^m points of every dimension hit each of the 2^m equal subintervals exactly once.
+ */
+template<std::size_t Dims>
+  requires(Dims > 0 && Dims <= detail::sobol_polynomials.size() + 1)
+class sobol_sequence {
+public:
+  static constexpr std::size_t dimensions = Dims;
+  using result_type = std::array<double, Dims>;
+
+  /**
+   * @brief The number of points the sequence can produce
+   */
+  static constexpr std::uint64_t max_size = std::uint64_t{1} << detail::sobol_bits;
+
+  sobol_sequence() = default;
+  explicit sobol_sequence(std::uint64_t index) { seek(index); }
+
+  result_type operator()()
+  {
+    gsl_Expects(index_ < max_size);
+    result_type u;
+    for (std::size_t d = 0; d < Dims; ++d) u[d] = static_cast<double>(x_[d]) * 0x1p-32;
+    ++index_;
+    if (index_ < max_size) {
+      const auto bit = std::countr_zero(index_);
+      for (std::size_t d = 0; d < Dims; ++d) x_[d] ^= directions[d][static_cast<std::size_t>(bit)];
+    }
+    return u;
+  }
+
+  /**
+   * @brief Moves to the point with the given index
+   */
+  void seek(std::uint64_t index)
+  {
+    gsl_Expects(index <= max_size);
+    index_ = index;
+    x_ = {};
+    const std::uint64_t gray = index ^ (index >> 1);
+    for (std::size_t k = 0; k < detail::sobol_bits; ++k)
+      if ((gray >> k) & 1)
+        for (std::size_t d = 0; d < Dims; ++d) x_[d] ^= directions[d][k];
+  }
+
+  void discard(std::uint64_t n) { seek(index_ + n); }
+
+  /**
+   * @brief The index of the next point
+   */
+  [[nodiscard]] std::uint64_t position() const { return index_; }
+
+  [[nodiscard]] friend bool operator==(const sobol_sequence&, const sobol_sequence&) = default;
+
+private:
+  static constexpr auto directions = [] {
+    std::array<std::array<std::uint32_t, detail::sobol_bits>, Dims> v;
+    for (std::size_t d = 0; d < Dims; ++d) v[d] = detail::sobol_directions(d);
+    return v;
+  }();
+
+  std::uint64_t index_ = 0;
+  std::array<std::uint32_t, Dims> x_{};
+};
+
+/**
+ * @brief The Halton low-discrepancy sequence in the `Dims`-dimensional unit hypercube
+ *
+ * The dimension `d` is the radical inverse of the point index in the base of the `d`-th prime.
+ * Points can be computed in any order, but the projections on pairs of high dimensions get
+ * correlated, so the Sobol sequence is usually the better choice for more than ~10 dimensions.
+ */
+template<std::size_t Dims>
+  requires(Dims > 0 && Dims <= detail::halton_bases.size())
+class halton_sequence {
+public:
+  static constexpr std::size_t dimensions = Dims;
+  using result_type = std::array<double, Dims>;
+
+  /**
+   * @brief The number of points the sequence can produce
+   */
+  static constexpr std::uint64_t max_size = std::uint64_t{1} << 56;
+
+  halton_sequence() = default;
+  explicit halton_sequence(std::uint64_t index) { seek(index); }
+
+  result_type operator()()
+  {
+    gsl_Expects(index_ < max_size);
+    result_type u;
+    for (std::size_t d = 0; d < Dims; ++d) u[d] = radical_inverse(index_, detail::halton_bases[d]);
+    ++index_;
+    return u;
+  }
+
+  /**
+   * @brief Moves to the point with the given index
+   */
+  void seek(std::uint64_t index)
+  {
+    gsl_Expects(index <= max_size);
+    index_ = index;
+  }
+
+  void discard(std::uint64_t n) { seek(index_ + n); }
+
+  /**
+   * @brief The index of the next point
+   */
+  [[nodiscard]] std::uint64_t position() const { return index_; }
+
+  [[nodiscard]] friend bool operator==(const halton_sequence&, const halton_sequence&) = default;
+
+private:
+  std::uint64_t index_ = 0;
+
+  [[nodiscard]] static double radical_inverse(std::uint64_t i, std::uint32_t base)
+  {
+    // the digits are reversed in integers to get exact results for the strata boundaries
+    std::uint64_t reversed = 0;
+    std::uint64_t denominator = 1;
+    for (; i > 0; i /= base) {
+      reversed = reversed * base + i % base;
+      denominator *= base;
+    }
+    return static_cast<double>(reversed) / static_cast<double>(denominator);
+  }
+};
+
+/**
+ * @brief Samples the product of ranges of quantities with a low-discrepancy `Sequence`
+ *
+ * The point with index `i` of the sequence is mapped to `min + u * (max - min)` in every
+ * dimension. The samples can be produced as tuples of quantities or in separate columns
+ * (structure of arrays), and the result of the bulk generation depends only on the starting
+ * `position()`, so it can be partitioned between threads deterministically.
+ */
+template<typename Sequence, Quantity... Qs>
+  requires(Sequence::dimensions == sizeof...(Qs))
+class low_discrepancy_sampler {
+public:
+  using sequence_type = Sequence;
+  using result_type = std::tuple<Qs...>;
+
+  explicit low_discrepancy_sampler(std::pair<Qs, Qs>... ranges) : box_(ranges...) {}
+
+  result_type operator()() { return box_.map(seq_()); }
+
+  void generate(std::span<result_type> out)
+  {
+    for (result_type& x : out) x = (*this)();
+  }
+
+  void generate(std::span<Qs>... columns)
+  {
+    const std::size_t size = std::get<0>(std::tie(columns...)).size();
+    gsl_Expects(((columns.size() == size) && ...));
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto u = seq_();
+      [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        ((columns[i] = box_.template map<Is>(u[Is])), ...);
+      }(std::index_sequence_for<Qs...>{});
+    }
+  }
+
+  void generate(std::tuple<std::span<Qs>...> columns)
+  {
+    std::apply([&](auto... c) { generate(c...); }, columns);
+  }
+
+  void seek(std::uint64_t index) { seq_.seek(index); }
+  void discard(std::uint64_t n) { seq_.discard(n); }
+  [[nodiscard]] std::uint64_t position() const { return seq_.position(); }
+
+  [[nodiscard]] result_type min() const { return box_.min(); }
+  [[nodiscard]] result_type max() const { return box_.max(); }
+
+private:
+  detail::quantity_box<Qs...> box_;
+  Sequence seq_;
+};
+
+template<Quantity... Qs>
+using sobol_sampler = low_discrepancy_sampler<sobol_sequence<sizeof...(Qs)>, Qs...>;
+
+template<Quantity... Qs>
+using halton_sampler = low_discrepancy_sampler<halton_sequence<sizeof...(Qs)>, Qs...>;
+
+/**
+ * @brief Fills `out` with the consecutive samples of `sampler` using many threads
+ *
+ * The chunk starting at `offset` is filled by a copy of `sampler` moved to
+ * `sampler.position() + offset`, so the result is the same as the one of `sampler.generate(out)`
+ * for any number of threads. `sampler` itself is not advanced.
+ */
+template<typename Sequence, Quantity... Qs>
+void parallel_generate(const low_discrepancy_sampler<Sequence, Qs...>& sampler,
+                       std::span<std::tuple<Qs...>> out, unsigned threads = std::thread::hardware_concurrency(),
+                       std::size_t chunk_size = 16384)
+{
+  detail::parallel_for_chunks(out.size(), chunk_size, threads, [&](std::size_t, std::size_t offset, std::size_t n) {
+    auto s = sampler;
+    s.discard(offset);
+    s.generate(out.subspan(offset, n));
+  });
+}
+
+template<typename Sequence, Quantity... Qs>
+void parallel_generate(const low_discrepancy_sampler<Sequence, Qs...>& sampler,
+                       std::tuple<std::span<Qs>...> columns, unsigned threads = std::thread::hardware_concurrency(),
+                       std::size_t chunk_size = 16384)
+{
+  const std::size_t size = std::get<0>(columns).size();
+  gsl_Expects(std::apply([&](auto... c) { return ((c.size() == size) && ...); }, columns));
+  detail::parallel_for_chunks(size, chunk_size, threads, [&](std::size_t, std::size_t offset, std::size_t n) {
+    auto s = sampler;
+    s.discard(offset);
+    std::apply([&](auto... c) { s.generate(c.subspan(offset, n)...); }, columns);
+  });
+}
+
+/**
+ * @brief Latin hypercube sampling of the product of ranges of quantities
+ *
+ * A design of `n` samples splits every range into `n` equal strata and puts exactly one sample
+ * in each stratum of every dimension, at a random position within the stratum. The strata of
+ * different dimensions are paired by independent random permutations (M. D. McKay et al., 1979).
+ *
+ * Unlike the low-discrepancy sequences, the whole design has to be generated at once.
+ */
+template<Quantity... Qs>
+class latin_hypercube_sampler {
+  template<std::size_t I>
+  using quantity_type = std::tuple_element_t<I, std::tuple<Qs...>>;
+
+public:
+  using result_type = std::tuple<Qs...>;
+  static constexpr std::size_t dimensions = sizeof...(Qs);
+
+  explicit latin_hypercube_sampler(std::pair<Qs, Qs>... ranges) : box_(ranges...) {}
+
+  template<typename Generator>
+  void generate(Generator& g, std::span<result_type> out) const
+  {
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (..., fill<Is>(g, out.size(), [&](std::size_t i, quantity_type<Is> q) { std::get<Is>(out[i]) = q; }));
+    }(std::index_sequence_for<Qs...>{});
+  }
+
+  template<typename Generator>
+  void generate(Generator& g, std::span<Qs>... columns) const
+  {
+    const std::size_t size = std::get<0>(std::tie(columns...)).size();
+    gsl_Expects(((columns.size() == size) && ...));
+    const std::tuple<std::span<Qs>...> c(columns...);
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (..., generate_column<Is>(g, std::get<Is>(c)));
+    }(std::index_sequence_for<Qs...>{});
+  }
+
+  template<typename Generator>
+  void generate(Generator& g, std::tuple<std::span<Qs>...> columns) const
+  {
+    std::apply([&](auto... c) { generate(g, c...); }, columns);
+  }
+
+  /**
+   * @brief Fills the samples of the dimension `I` of a design of `column.size()` samples
+   *
+   * The dimensions of a design are independent, so they can be generated separately.
+   */
+  template<std::size_t I, typename Generator>
+  void generate_column(Generator& g, std::span<quantity_type<I>> column) const
+  {
+    fill<I>(g, column.size(), [&](std::size_t i, quantity_type<I> q) { column[i] = q; });
+  }
+
+  [[nodiscard]] result_type min() const { return box_.min(); }
+  [[nodiscard]] result_type max() const { return box_.max(); }
+
+private:
+  detail::quantity_box<Qs...> box_;
+
+  template<std::size_t I, typename Generator, typename Store>
+  void fill(Generator& g, std::size_t n, Store store) const
+  {
+    gsl_Expects(n <= std::numeric_limits<std::uint32_t>::max());
+    std::vector<std::uint32_t> strata(n);
+    std::iota(strata.begin(), strata.end(), std::uint32_t{0});
+    std::shuffle(strata.begin(), strata.end(), g);
+    const double inv_n = 1. / static_cast<double>(n);
+    std::array<double, detail::random_block_size> u;
+    for (std::size_t first = 0; first < n; first += u.size()) {
+      const auto jitter = std::span(u).first(std::min(u.size(), n - first));
+      detail::generate_canonical_block(g, jitter);
+      for (std::size_t j = 0; j < jitter.size(); ++j)
+        store(first + j, box_.template map<I>((strata[first + j] + jitter[j]) * inv_n));
+    }
+  }
+};
+
+/**
+ * @brief Fills the columns with a Latin hypercube design using a thread per dimension
+ *
+ * The dimension `i` is generated with `engine.split_substream(i)`, so the result is the same
+ * for any number of threads.
+ */
+template<Quantity... Qs>
+void parallel_generate(const latin_hypercube_sampler<Qs...>& sampler, const philox4x32& engine,
+                       std::tuple<std::span<Qs>...> columns, unsigned threads = std::thread::hardware_concurrency())
+{
+  const std::size_t size = std::get<0>(columns).size();
+  gsl_Expects(std::apply([&](auto... c) { return ((c.size() == size) && ...); }, columns));
+  detail::parallel_for_chunks(sizeof...(Qs), 1, threads, [&](std::size_t d, std::size_t, std::size_t) {
+    auto gen = engine.split_substream(static_cast<std::uint32_t>(d));
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (..., (d == Is ? sampler.template generate_column<Is>(gen, std::get<Is>(columns)) : void()));
+    }(std::index_sequence_for<Qs...>{});
+  });
+}
+
+}  // namespace mp_units
@@ -23,67 +23,305 @@
 #pragma once
 
 #include <mp-units/quantity.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numbers>
 #include <random>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace mp_units {
 
 namespace detail {
-template<Quantity Q, typename InputIt>
-static std::vector<typename Q::rep> i_qty_to_rep(InputIt first, InputIt last)
+
+inline constexpr std::size_t random_block_size = 256;
+
+/**
+ * @brief Fills `u` with values uniformly distributed in [0, 1)
+ *
+ * Engines producing all the values of a 32 or 64-bit unsigned integer are converted directly;
+ * other engines go through `std::generate_canonical`.
+ */
+template<std::floating_point T, typename Generator>
+void generate_canonical_block(Generator& g, std::span<T> u)
 {
-  std::vector<typename Q::rep> intervals_rep;
-  intervals_rep.reserve(static_cast<size_t>(std::distance(first, last)));
-  for (auto itr = first; itr != last; ++itr) {
-    intervals_rep.push_back(itr->numerical_value());
+  constexpr int digits = std::numeric_limits<T>::digits;
+  constexpr bool full_64 = Generator::min() == 0 && Generator::max() == std::numeric_limits<std::uint64_t>::max();
+  constexpr bool full_32 = Generator::min() == 0 && Generator::max() == std::numeric_limits<std::uint32_t>::max();
+  if constexpr (digits < 64 && (full_64 || full_32)) {
+    constexpr T scale = T{1} / static_cast<T>(std::uint64_t{1} << digits);
+    for (T& x : u) {
+      std::uint64_t bits = static_cast<std::uint64_t>(g());
+      if constexpr (full_32) {
+        if constexpr (digits <= 32)
+          bits <<= 32;
+        else
+          bits = (bits << 32) | static_cast<std::uint64_t>(g());
+      }
+      x = static_cast<T>(bits >> (64 - digits)) * scale;
+    }
+  } else {
+    for (T& x : u) x = std::generate_canonical<T, digits>(g);
   }
-  return intervals_rep;
 }
 
-template<Quantity Q>
-static std::vector<typename Q::rep> bl_qty_to_rep(std::initializer_list<Q>& bl)
+/**
+ * @brief Fills `out` in blocks of uniform values in [0, 1) transformed in place by `transform`
+ *
+ * `transform` is always given a multiple of `Step` values.
+ */
+template<Quantity Q, std::size_t Step = 1, typename Generator, typename Transform>
+void generate_transformed(Generator& g, std::span<Q> out, Transform transform)
 {
-  std::vector<typename Q::rep> bl_rep;
-  bl_rep.reserve(bl.size());
-  for (const Q& qty : bl) {
-    bl_rep.push_back(qty.numerical_value());
+  using rep = MP_UNITS_TYPENAME Q::rep;
+  std::array<rep, random_block_size> block;
+  while (!out.empty()) {
+    const std::size_t count = std::min(out.size(), block.size());
+    const auto values = std::span(block).first((count + Step - 1) / Step * Step);
+    generate_canonical_block(g, values);
+    transform(values);
+    std::ranges::transform(values.first(count), out.begin(), [](rep v) { return make_quantity<Q::reference>(v); });
+    out = out.subspan(count);
   }
-  return bl_rep;
 }
 
-template<Quantity Q, typename UnaryOperation>
-inline static std::vector<typename Q::rep> fw_bl_pwc(std::initializer_list<Q>& bl, UnaryOperation fw)
-{
+/**
+ * @brief Parameters of a piecewise distribution of quantities
+ *
+ * Holds the parameters of the underlying `std` distribution together with its intervals and
+ * densities, which are exposed without copying. The parameters are immutable, so copies
+ * share them and a single object can be used by many threads at once.
+ */
+template<Quantity Q, typename Base>
+class piecewise_param {
   using rep = MP_UNITS_TYPENAME Q::rep;
-  std::vector<rep> w_bl;
-  w_bl.reserve(bl.size());
-  for (const Q& qty : bl) {
-    w_bl.push_back(fw(qty));
-  }
-  std::vector<rep> weights;
-  weights.reserve(bl.size());
-  for (size_t i = 0; i < bl.size() - 1; ++i) {
-    weights.push_back(w_bl[i] + w_bl[i + 1]);
-  }
-  weights.push_back(0);
-  return weights;
-}
+  using base_param = MP_UNITS_TYPENAME Base::param_type;
+  static constexpr bool is_constant = std::is_same_v<Base, std::piecewise_constant_distribution<rep>>;
+
+  // the `std` parameters are built in place as they can only be copied
+  struct state {
+    base_param param;
+    std::vector<rep> intervals;
+    std::vector<double> densities;
+
+    template<typename... Args>
+    explicit state(std::in_place_t, Args&&... args) :
+        param(std::forward<Args>(args)...), intervals(param.intervals()), densities(param.densities())
+    {
+    }
 
-template<Quantity Q, typename UnaryOperation>
-static std::vector<typename Q::rep> fw_bl_pwl(std::initializer_list<Q>& bl, UnaryOperation fw)
-{
-  std::vector<typename Q::rep> weights;
-  weights.reserve(bl.size());
-  for (const Q& qty : bl) {
-    weights.push_back(fw(qty));
+    // fewer than 2 boundaries mean the default [0, 1) interval
+    template<typename InputIt>
+    state(std::vector<rep> b, InputIt first_w) :
+        param(b.begin(), b.end(), first_w),
+        intervals(b.size() < 2 ? param.intervals() : std::move(b)),
+        densities(param.densities())
+    {
+    }
+  };
+
+  static constexpr auto to_rep = [](const Q& q) { return q.numerical_value(); };
+
+public:
+  piecewise_param() : state_(std::make_shared<const state>(std::in_place)) {}
+
+  explicit piecewise_param(const base_param& p) : state_(std::make_shared<const state>(std::in_place, p)) {}
+
+  template<typename InputIt1, typename InputIt2>
+  piecewise_param(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
+      state_(std::make_shared<const state>(boundaries(std::ranges::subrange(first_i, last_i)), first_w))
+  {
   }
-  return weights;
-}
+
+  // the weights are `fw` of the midpoints of the intervals (piecewise constant) or of the boundaries (piecewise linear)
+  template<typename UnaryOperation>
+  piecewise_param(std::initializer_list<Q> bl, UnaryOperation fw) :
+      state_(std::make_shared<const state>(boundaries(bl), weights(bl, fw).begin()))
+  {
+  }
+
+  template<typename UnaryOperation>
+  piecewise_param(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw) :
+      state_(std::make_shared<const state>(std::in_place, nw, xmin.numerical_value(), xmax.numerical_value(),
+                                           [fw](rep val) { return fw(val * Q::reference); }))
+  {
+  }
+
+  [[nodiscard]] const base_param& base() const noexcept { return state_->param; }
+
+  /**
+   * @brief The boundaries of the intervals as a view of quantities
+   *
+   * The view shares the ownership of the parameters, so it stays valid also after the parameters
+   * (or the distribution it was obtained from) are destroyed.
+   */
+  [[nodiscard]] auto intervals() const noexcept
+  {
+    return std::span<const rep>(state_->intervals) |
+           std::views::transform([s = state_](rep v) { return v * Q::reference; });
+  }
+
+  /**
+   * @brief The densities of the intervals (piecewise constant) or of the boundaries (piecewise linear)
+   *
+   * The span is valid as long as any object sharing these parameters exists.
+   */
+  [[nodiscard]] std::span<const double> densities() const noexcept { return state_->densities; }
+
+  [[nodiscard]] friend bool operator==(const piecewise_param& lhs, const piecewise_param& rhs)
+  {
+    return lhs.state_ == rhs.state_ || lhs.base() == rhs.base();
+  }
+
+private:
+  std::shared_ptr<const state> state_;
+
+  template<std::ranges::input_range R>
+  [[nodiscard]] static std::vector<rep> boundaries(R&& r)
+  {
+    std::vector<rep> b;
+    if constexpr (std::ranges::sized_range<R>) b.reserve(std::ranges::size(r));
+    for (const Q& q : r) b.push_back(to_rep(q));
+    return b;
+  }
+
+  template<typename UnaryOperation>
+  [[nodiscard]] static auto weights(const std::initializer_list<Q>& bl, UnaryOperation fw)
+  {
+    if constexpr (is_constant) {
+      const Q* b = bl.begin();
+      return std::views::iota(std::size_t{0}, std::max<std::size_t>(bl.size(), 1) - 1) |
+             std::views::transform([b, fw](std::size_t k) { return fw(0.5 * (b[k + 1] + b[k])); });
+    } else
+      return bl | std::views::transform([fw](const Q& q) { return fw(q); });
+  }
+};
+
+/**
+ * @brief Walker's alias table built with Vose's algorithm
+ *
+ * Selects an index with the probability proportional to its weight in O(1) using a single
+ * uniform value. The probabilities and aliases are stored in separate contiguous arrays.
+ */
+class alias_table {
+public:
+  alias_table() : prob_{1.0}, alias_{0} {}
+
+  explicit alias_table(std::span<const double> weights) : prob_(weights.size()), alias_(weights.size())
+  {
+    const std::size_t n = weights.size();
+    gsl_Expects(n > 0 && n <= std::numeric_limits<std::uint32_t>::max());
+    double sum = 0;
+    for (double w : weights) {
+      gsl_Expects(w >= 0);
+      sum += w;
+    }
+    gsl_Expects(sum > 0);
+
+    std::vector<double> scaled(n);
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> large;
+    for (std::size_t i = 0; i < n; ++i) {
+      scaled[i] = weights[i] * static_cast<double>(n) / sum;
+      (scaled[i] < 1 ? small : large).push_back(static_cast<std::uint32_t>(i));
+    }
+    while (!small.empty() && !large.empty()) {
+      const std::uint32_t s = small.back();
+      small.pop_back();
+      const std::uint32_t l = large.back();
+      prob_[s] = scaled[s];
+      alias_[s] = l;
+      scaled[l] = (scaled[l] + scaled[s]) - 1;
+      if (scaled[l] < 1) {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+    // the leftovers differ from 1 only by rounding errors
+    for (const std::vector<std::uint32_t>* rest : {&large, &small})
+      for (std::uint32_t i : *rest) {
+        prob_[i] = 1;
+        alias_[i] = i;
+      }
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return prob_.size(); }
+
+  /**
+   * @brief Returns the index selected by `u` from [0, 1)
+   *
+   * The integral part of `u * size()` selects a column and its fractional part decides between
+   * the column and its alias. `u` is always a `double` as a `float` does not have enough
+   * precision for both parts in large tables.
+   */
+  [[nodiscard]] std::size_t operator()(double u) const noexcept
+  {
+    const double x = u * static_cast<double>(prob_.size());
+    const std::size_t i = std::min(static_cast<std::size_t>(x), prob_.size() - 1);
+    return x - static_cast<double>(i) < prob_[i] ? i : alias_[i];
+  }
+
+  [[nodiscard]] friend bool operator==(const alias_table&, const alias_table&) = default;
+
+private:
+  std::vector<double> prob_;
+  std::vector<std::uint32_t> alias_;
+};
+
+/**
+ * @brief Bulk sampling for the distributions of quantities
+ *
+ * The default `generate()` samples every value with the distribution's `operator()`; distributions
+ * with a faster block algorithm provide their own.
+ */
+template<typename Derived, Quantity Q>
+struct bulk_generator {
+  /**
+   * @brief Fills `out` with samples of the distribution
+   *
+   * A faster block algorithm may consume the random numbers in a different way, so the samples
+   * may differ from the ones obtained by consecutive calls to `operator()`.
+   */
+  template<typename Generator>
+  void generate(Generator& g, std::span<Q> out)
+  {
+    for (Q& q : out) q = static_cast<Derived&>(*this)(g);
+  }
+
+  /**
+   * @brief Writes `n` samples of the distribution to `out`
+   */
+  template<typename Generator, std::output_iterator<Q> OutputIt>
+  OutputIt generate_n(Generator& g, OutputIt out, std::size_t n)
+  {
+    std::array<Q, random_block_size> block;
+    while (n > 0) {
+      const auto values = std::span(block).first(std::min(n, block.size()));
+      static_cast<Derived&>(*this).generate(g, values);
+      out = std::ranges::copy(values, out).out;
+      n -= values.size();
+    }
+    return out;
+  }
+};
+
 }  // namespace detail
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct uniform_int_distribution : public std::uniform_int_distribution<typename Q::rep> {
+struct uniform_int_distribution :
+    public std::uniform_int_distribution<typename Q::rep>,
+    public detail::bulk_generator<uniform_int_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::uniform_int_distribution<rep>;
 
@@ -105,7 +343,9 @@ struct uniform_int_distribution : public std::uniform_int_distribution<typename
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct uniform_real_distribution : public std::uniform_real_distribution<typename Q::rep> {
+struct uniform_real_distribution :
+    public std::uniform_real_distribution<typename Q::rep>,
+    public detail::bulk_generator<uniform_real_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::uniform_real_distribution<rep>;
 
@@ -121,13 +361,25 @@ struct uniform_real_distribution : public std::uniform_real_distribution<typenam
   Q a() const { return base::a() * Q::reference; }
   Q b() const { return base::b() * Q::reference; }
 
+  template<typename Generator>
+  void generate(Generator& g, std::span<Q> out)
+  {
+    const rep a = base::a();
+    const rep width = base::b() - base::a();
+    detail::generate_transformed<Q>(g, out, [&](std::span<rep> u) {
+      for (rep& x : u) x = a + width * x;
+    });
+  }
+
   Q min() const { return base::min() * Q::reference; }
   Q max() const { return base::max() * Q::reference; }
 };
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct binomial_distribution : public std::binomial_distribution<typename Q::rep> {
+struct binomial_distribution :
+    public std::binomial_distribution<typename Q::rep>,
+    public detail::bulk_generator<binomial_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::binomial_distribution<rep>;
 
@@ -148,7 +400,9 @@ struct binomial_distribution : public std::binomial_distribution<typename Q::rep
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct negative_binomial_distribution : public std::negative_binomial_distribution<typename Q::rep> {
+struct negative_binomial_distribution :
+    public std::negative_binomial_distribution<typename Q::rep>,
+    public detail::bulk_generator<negative_binomial_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::negative_binomial_distribution<rep>;
 
@@ -169,7 +423,9 @@ struct negative_binomial_distribution : public std::negative_binomial_distributi
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct geometric_distribution : public std::geometric_distribution<typename Q::rep> {
+struct geometric_distribution :
+    public std::geometric_distribution<typename Q::rep>,
+    public detail::bulk_generator<geometric_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::geometric_distribution<rep>;
 
@@ -188,7 +444,9 @@ struct geometric_distribution : public std::geometric_distribution<typename Q::r
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct poisson_distribution : public std::poisson_distribution<typename Q::rep> {
+struct poisson_distribution :
+    public std::poisson_distribution<typename Q::rep>,
+    public detail::bulk_generator<poisson_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::poisson_distribution<rep>;
 
@@ -207,7 +465,9 @@ struct poisson_distribution : public std::poisson_distribution<typename Q::rep>
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct exponential_distribution : public std::exponential_distribution<typename Q::rep> {
+struct exponential_distribution :
+    public std::exponential_distribution<typename Q::rep>,
+    public detail::bulk_generator<exponential_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::exponential_distribution<rep>;
 
@@ -220,13 +480,25 @@ struct exponential_distribution : public std::exponential_distribution<typename
     return base::operator()(g) * Q::reference;
   }
 
+  // inverse transform sampling
+  template<typename Generator>
+  void generate(Generator& g, std::span<Q> out)
+  {
+    const rep scale = -1 / base::lambda();
+    detail::generate_transformed<Q>(g, out, [&](std::span<rep> u) {
+      for (rep& x : u) x = scale * std::log(1 - x);
+    });
+  }
+
   Q min() const { return base::min() * Q::reference; }
   Q max() const { return base::max() * Q::reference; }
 };
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct gamma_distribution : public std::gamma_distribution<typename Q::rep> {
+struct gamma_distribution :
+    public std::gamma_distribution<typename Q::rep>,
+    public detail::bulk_generator<gamma_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::gamma_distribution<rep>;
 
@@ -245,7 +517,9 @@ struct gamma_distribution : public std::gamma_distribution<typename Q::rep> {
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct weibull_distribution : public std::weibull_distribution<typename Q::rep> {
+struct weibull_distribution :
+    public std::weibull_distribution<typename Q::rep>,
+    public detail::bulk_generator<weibull_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::weibull_distribution<rep>;
 
@@ -264,7 +538,9 @@ struct weibull_distribution : public std::weibull_distribution<typename Q::rep>
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct extreme_value_distribution : public std::extreme_value_distribution<typename Q::rep> {
+struct extreme_value_distribution :
+    public std::extreme_value_distribution<typename Q::rep>,
+    public detail::bulk_generator<extreme_value_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::extreme_value_distribution<rep>;
 
@@ -274,7 +550,7 @@ struct extreme_value_distribution : public std::extreme_value_distribution<typen
   template<typename Generator>
   Q operator()(Generator& g)
   {
-    return Q(base::operator()(g));
+    return base::operator()(g) * Q::reference;
   }
 
   Q a() const { return base::a() * Q::reference; }
@@ -285,7 +561,9 @@ struct extreme_value_distribution : public std::extreme_value_distribution<typen
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct normal_distribution : public std::normal_distribution<typename Q::rep> {
+struct normal_distribution :
+    public std::normal_distribution<typename Q::rep>,
+    public detail::bulk_generator<normal_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::normal_distribution<rep>;
 
@@ -295,19 +573,40 @@ struct normal_distribution : public std::normal_distribution<typename Q::rep> {
   template<typename Generator>
   Q operator()(Generator& g)
   {
-    return Q(base::operator()(g));
+    return base::operator()(g) * Q::reference;
   }
 
   Q mean() const { return base::mean() * Q::reference; }
   Q stddev() const { return base::stddev() * Q::reference; }
 
+  // Box-Muller transform of the first and the second half of every block
+  template<typename Generator>
+  void generate(Generator& g, std::span<Q> out)
+  {
+    const rep mean = base::mean();
+    const rep stddev = base::stddev();
+    detail::generate_transformed<Q, 2>(g, out, [&](std::span<rep> u) {
+      const std::size_t half = u.size() / 2;
+      rep* u1 = u.data();
+      rep* u2 = u.data() + half;
+      for (std::size_t i = 0; i < half; ++i) {
+        const rep r = stddev * std::sqrt(-2 * std::log(1 - u1[i]));
+        const rep theta = 2 * std::numbers::pi_v<rep> * u2[i];
+        u1[i] = mean + r * std::cos(theta);
+        u2[i] = mean + r * std::sin(theta);
+      }
+    });
+  }
+
   Q min() const { return base::min() * Q::reference; }
   Q max() const { return base::max() * Q::reference; }
 };
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct lognormal_distribution : public std::lognormal_distribution<typename Q::rep> {
+struct lognormal_distribution :
+    public std::lognormal_distribution<typename Q::rep>,
+    public detail::bulk_generator<lognormal_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::lognormal_distribution<rep>;
 
@@ -329,7 +628,9 @@ struct lognormal_distribution : public std::lognormal_distribution<typename Q::r
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct chi_squared_distribution : public std::chi_squared_distribution<typename Q::rep> {
+struct chi_squared_distribution :
+    public std::chi_squared_distribution<typename Q::rep>,
+    public detail::bulk_generator<chi_squared_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::chi_squared_distribution<rep>;
 
@@ -348,7 +649,9 @@ struct chi_squared_distribution : public std::chi_squared_distribution<typename
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct cauchy_distribution : public std::cauchy_distribution<typename Q::rep> {
+struct cauchy_distribution :
+    public std::cauchy_distribution<typename Q::rep>,
+    public detail::bulk_generator<cauchy_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::cauchy_distribution<rep>;
 
@@ -370,7 +673,9 @@ struct cauchy_distribution : public std::cauchy_distribution<typename Q::rep> {
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct fisher_f_distribution : public std::fisher_f_distribution<typename Q::rep> {
+struct fisher_f_distribution :
+    public std::fisher_f_distribution<typename Q::rep>,
+    public detail::bulk_generator<fisher_f_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::fisher_f_distribution<rep>;
 
@@ -389,7 +694,9 @@ struct fisher_f_distribution : public std::fisher_f_distribution<typename Q::rep
 
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-struct student_t_distribution : public std::student_t_distribution<typename Q::rep> {
+struct student_t_distribution :
+    public std::student_t_distribution<typename Q::rep>,
+    public detail::bulk_generator<student_t_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::student_t_distribution<rep>;
 
@@ -408,7 +715,9 @@ struct student_t_distribution : public std::student_t_distribution<typename Q::r
 
 template<Quantity Q>
   requires std::integral<typename Q::rep>
-struct discrete_distribution : public std::discrete_distribution<typename Q::rep> {
+struct discrete_distribution :
+    public std::discrete_distribution<typename Q::rep>,
+    public detail::bulk_generator<discrete_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::discrete_distribution<rep>;
 
@@ -437,120 +746,398 @@ struct discrete_distribution : public std::discrete_distribution<typename Q::rep
   Q max() const { return base::max() * Q::reference; }
 };
 
+/**
+ * @brief A piecewise constant distribution of quantities
+ *
+ * The distribution holds only its shared parameters. The `std` base class stays default
+ * constructed and is used only to sample with the parameters.
+ */
 template<Quantity Q>
   requires std::floating_point<typename Q::rep>
-class piecewise_constant_distribution : public std::piecewise_constant_distribution<typename Q::rep> {
+class piecewise_constant_distribution :
+    private std::piecewise_constant_distribution<typename Q::rep>,
+    public detail::bulk_generator<piecewise_constant_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
   using base = MP_UNITS_TYPENAME std::piecewise_constant_distribution<rep>;
 
-  template<typename InputIt>
-  piecewise_constant_distribution(const std::vector<rep>& i, InputIt first_w) : base(i.cbegin(), i.cend(), first_w)
+public:
+  using param_type = detail::piecewise_param<Q, base>;
+
+  piecewise_constant_distribution() = default;
+
+  template<typename InputIt1, typename InputIt2>
+  piecewise_constant_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
+      piecewise_constant_distribution(param_type(first_i, last_i, first_w))
+  {
+  }
+
+  template<typename UnaryOperation>
+  piecewise_constant_distribution(std::initializer_list<Q> bl, UnaryOperation fw) :
+      piecewise_constant_distribution(param_type(bl, fw))
+  {
+  }
+
+  template<typename UnaryOperation>
+  piecewise_constant_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw) :
+      piecewise_constant_distribution(param_type(nw, xmin, xmax, fw))
+  {
+  }
+
+  explicit piecewise_constant_distribution(const param_type& p) : param_(p) {}
+
+  template<typename Generator>
+  Q operator()(Generator& g)
   {
+    return base::operator()(g, param_.base()) * Q::reference;
   }
 
-  piecewise_constant_distribution(const std::vector<rep>& bl, const std::vector<rep>& weights) :
-      base(bl.cbegin(), bl.cend(), weights.cbegin())
+  // samples with shared parameters without copying them
+  template<typename Generator>
+  Q operator()(Generator& g, const param_type& p)
   {
+    return base::operator()(g, p.base()) * Q::reference;
   }
 
+  void reset() {}
+
+  param_type param() const { return param_; }
+  void param(const param_type& p) { param_ = p; }
+
+  auto intervals() const { return param_.intervals(); }
+  std::span<const double> densities() const { return param_.densities(); }
+
+  Q min() const { return param_.intervals().front(); }
+  Q max() const { return param_.intervals().back(); }
+
+private:
+  param_type param_;
+};
+
+/**
+ * @brief A piecewise linear distribution of quantities
+ *
+ * The distribution holds only its shared parameters. The `std` base class stays default
+ * constructed and is used only to sample with the parameters.
+ */
+template<Quantity Q>
+  requires std::floating_point<typename Q::rep>
+class piecewise_linear_distribution :
+    private std::piecewise_linear_distribution<typename Q::rep>,
+    public detail::bulk_generator<piecewise_linear_distribution<Q>, Q> {
+  using rep = MP_UNITS_TYPENAME Q::rep;
+  using base = MP_UNITS_TYPENAME std::piecewise_linear_distribution<rep>;
+
 public:
-  piecewise_constant_distribution() : base() {}
+  using param_type = detail::piecewise_param<Q, base>;
+
+  piecewise_linear_distribution() = default;
 
   template<typename InputIt1, typename InputIt2>
-  piecewise_constant_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
-      piecewise_constant_distribution(detail::i_qty_to_rep<Q>(first_i, last_i), first_w)
+  piecewise_linear_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
+      piecewise_linear_distribution(param_type(first_i, last_i, first_w))
   {
   }
 
   template<typename UnaryOperation>
-  piecewise_constant_distribution(std::initializer_list<Q> bl, UnaryOperation fw) :
-      piecewise_constant_distribution(detail::bl_qty_to_rep(bl), detail::fw_bl_pwc(bl, fw))
+  piecewise_linear_distribution(std::initializer_list<Q> bl, UnaryOperation fw) :
+      piecewise_linear_distribution(param_type(bl, fw))
   {
   }
 
   template<typename UnaryOperation>
-  piecewise_constant_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw) :
-      base(nw, xmin.numerical_value(), xmax.numerical_value(), [fw](rep val) { return fw(val * Q::reference); })
+  piecewise_linear_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw) :
+      piecewise_linear_distribution(param_type(nw, xmin, xmax, fw))
   {
   }
 
+  explicit piecewise_linear_distribution(const param_type& p) : param_(p) {}
+
   template<typename Generator>
   Q operator()(Generator& g)
   {
-    return base::operator()(g) * Q::reference;
+    return base::operator()(g, param_.base()) * Q::reference;
   }
 
-  std::vector<Q> intervals() const
+  // samples with shared parameters without copying them
+  template<typename Generator>
+  Q operator()(Generator& g, const param_type& p)
   {
-    std::vector<rep> intervals_rep = base::intervals();
-    std::vector<Q> intervals_qty;
-    intervals_qty.reserve(intervals_rep.size());
-    for (const rep& val : intervals_rep) {
-      intervals_qty.push_back(val * Q::reference);
-    }
-    return intervals_qty;
+    return base::operator()(g, p.base()) * Q::reference;
   }
 
-  Q min() const { return base::min() * Q::reference; }
-  Q max() const { return base::max() * Q::reference; }
+  void reset() {}
+
+  param_type param() const { return param_; }
+  void param(const param_type& p) { param_ = p; }
+
+  auto intervals() const { return param_.intervals(); }
+  std::span<const double> densities() const { return param_.densities(); }
+
+  Q min() const { return param_.intervals().front(); }
+  Q max() const { return param_.intervals().back(); }
+
+private:
+  param_type param_;
 };
 
+/**
+ * @brief A discrete distribution sampled with an alias table
+ *
+ * Produces the same distribution as `discrete_distribution` but every sample costs O(1) instead
+ * of a binary search over the cumulative weights (at the cost of a slower construction).
+ */
 template<Quantity Q>
-  requires std::floating_point<typename Q::rep>
-class piecewise_linear_distribution : public std::piecewise_linear_distribution<typename Q::rep> {
+  requires std::integral<typename Q::rep>
+class alias_discrete_distribution : public detail::bulk_generator<alias_discrete_distribution<Q>, Q> {
   using rep = MP_UNITS_TYPENAME Q::rep;
-  using base = MP_UNITS_TYPENAME std::piecewise_linear_distribution<rep>;
+
+public:
+  alias_discrete_distribution() : probabilities_{1.0} {}
 
   template<typename InputIt>
-  piecewise_linear_distribution(const std::vector<rep>& i, InputIt first_w) : base(i.cbegin(), i.cend(), first_w)
+  alias_discrete_distribution(InputIt first, InputIt last) :
+      alias_discrete_distribution(std::vector<double>(first, last))
+  {
+  }
+
+  alias_discrete_distribution(std::initializer_list<double> weights) :
+      alias_discrete_distribution(std::vector<double>(weights))
+  {
+  }
+
+  template<typename UnaryOperation>
+  alias_discrete_distribution(std::size_t count, double xmin, double xmax, UnaryOperation unary_op) :
+      alias_discrete_distribution(weights(count, xmin, xmax, unary_op))
   {
   }
 
-  piecewise_linear_distribution(const std::vector<rep>& bl, const std::vector<rep>& weights) :
-      base(bl.cbegin(), bl.cend(), weights.cbegin())
+  template<typename Generator>
+  Q operator()(Generator& g)
   {
+    std::array<double, 1> u;
+    detail::generate_canonical_block(g, std::span<double>(u));
+    return static_cast<rep>(table_(u[0])) * Q::reference;
   }
 
+  template<typename Generator>
+  void generate(Generator& g, std::span<Q> out)
+  {
+    std::array<double, detail::random_block_size> u;
+    while (!out.empty()) {
+      const auto values = std::span(u).first(std::min(out.size(), u.size()));
+      detail::generate_canonical_block(g, values);
+      std::ranges::transform(values, out.begin(),
+                             [&](double v) { return static_cast<rep>(table_(v)) * Q::reference; });
+      out = out.subspan(values.size());
+    }
+  }
+
+  const std::vector<double>& probabilities() const { return probabilities_; }
+
+  Q min() const { return rep{0} * Q::reference; }
+  Q max() const { return static_cast<rep>(probabilities_.size() - 1) * Q::reference; }
+
+private:
+  std::vector<double> probabilities_;
+  detail::alias_table table_;
+
+  explicit alias_discrete_distribution(std::vector<double> weights) : probabilities_(std::move(weights))
+  {
+    // no weights mean a single value as in `std::discrete_distribution`
+    if (probabilities_.empty()) probabilities_ = {1.0};
+    table_ = detail::alias_table(probabilities_);
+    double sum = 0;
+    for (double w : probabilities_) sum += w;
+    for (double& w : probabilities_) w /= sum;
+  }
+
+  // the same weights as the ones of `std::discrete_distribution`
+  template<typename UnaryOperation>
+  static std::vector<double> weights(std::size_t count, double xmin, double xmax, UnaryOperation unary_op)
+  {
+    const std::size_t n = std::max<std::size_t>(count, 1);
+    const double delta = (xmax - xmin) / static_cast<double>(n);
+    std::vector<double> w;
+    w.reserve(n);
+    for (std::size_t k = 0; k < n; ++k) w.push_back(unary_op(xmin + static_cast<double>(k) * delta + 0.5 * delta));
+    return w;
+  }
+};
+
+namespace detail {
+
+/**
+ * @brief The common part of the piecewise distributions sampled with an alias table
+ *
+ * An interval is selected with an alias table built from the probabilities of the intervals and
+ * the value within the interval is obtained by inverting the (constant or linear) CDF in O(1).
+ * The parameters have the same meaning as the ones of `std::piecewise_constant_distribution` and
+ * `std::piecewise_linear_distribution`.
+ */
+template<typename Derived, Quantity Q, bool Linear>
+class alias_piecewise_distribution : public bulk_generator<Derived, Q> {
+  using rep = MP_UNITS_TYPENAME Q::rep;
+  static constexpr auto to_rep = [](const Q& q) { return q.numerical_value(); };
+  static constexpr struct from_boundaries_t {
+  } from_boundaries{};
+
 public:
-  piecewise_linear_distribution() : base() {}
+  alias_piecewise_distribution() : alias_piecewise_distribution(from_boundaries, {0, 1}, std::vector<double>{1, 1}) {}
 
   template<typename InputIt1, typename InputIt2>
-  piecewise_linear_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
-      piecewise_linear_distribution(detail::i_qty_to_rep<Q>(first_i, last_i), first_w)
+  alias_piecewise_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
+      alias_piecewise_distribution(from_boundaries, boundaries(std::ranges::subrange(first_i, last_i)), first_w)
   {
   }
 
   template<typename UnaryOperation>
-  piecewise_linear_distribution(std::initializer_list<Q> bl, UnaryOperation fw) :
-      piecewise_linear_distribution(detail::bl_qty_to_rep(bl), detail::fw_bl_pwl(bl, fw))
+  alias_piecewise_distribution(std::initializer_list<Q> bl, UnaryOperation fw) :
+      alias_piecewise_distribution(from_boundaries, boundaries(bl), fw)
   {
   }
 
   template<typename UnaryOperation>
-  piecewise_linear_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw) :
-      base(nw, xmin.numerical_value(), xmax.numerical_value(), [fw](rep val) { return fw(val * Q::reference); })
+  alias_piecewise_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw) :
+      alias_piecewise_distribution(from_boundaries, boundaries(nw, xmin.numerical_value(), xmax.numerical_value()), fw)
   {
   }
 
   template<typename Generator>
   Q operator()(Generator& g)
   {
-    return base::operator()(g) * Q::reference;
+    std::array<double, 1> u1;
+    std::array<rep, 1> u2;
+    generate_canonical_block(g, std::span<double>(u1));
+    generate_canonical_block(g, std::span<rep>(u2));
+    return sample(u1[0], u2[0]) * Q::reference;
   }
 
-  std::vector<Q> intervals() const
+  template<typename Generator>
+  void generate(Generator& g, std::span<Q> out)
   {
-    std::vector<rep> intervals_rep = base::intervals();
-    std::vector<Q> intervals_qty;
-    intervals_qty.reserve(intervals_rep.size());
-    for (const rep& val : intervals_rep) {
-      intervals_qty.push_back(val * Q::reference);
+    std::array<double, random_block_size> u1;
+    std::array<rep, random_block_size> u2;
+    while (!out.empty()) {
+      const std::size_t count = std::min(out.size(), random_block_size);
+      generate_canonical_block(g, std::span(u1).first(count));
+      generate_canonical_block(g, std::span(u2).first(count));
+      for (std::size_t i = 0; i < count; ++i) out[i] = sample(u1[i], u2[i]) * Q::reference;
+      out = out.subspan(count);
     }
-    return intervals_qty;
   }
 
-  Q min() const { return base::min() * Q::reference; }
-  Q max() const { return base::max() * Q::reference; }
+  [[nodiscard]] auto intervals() const
+  {
+    return std::span<const rep>(intervals_) | std::views::transform([](rep v) { return v * Q::reference; });
+  }
+
+  [[nodiscard]] std::span<const double> densities() const { return densities_; }
+
+  Q min() const { return intervals_.front() * Q::reference; }
+  Q max() const { return intervals_.back() * Q::reference; }
+
+private:
+  std::vector<rep> intervals_;
+  std::vector<double> densities_;
+  alias_table table_;
+
+  template<std::ranges::input_range R>
+  [[nodiscard]] static std::vector<rep> boundaries(R&& r)
+  {
+    std::vector<rep> b;
+    for (const Q& q : r) b.push_back(to_rep(q));
+    return b;
+  }
+
+  [[nodiscard]] static std::vector<rep> boundaries(std::size_t nw, rep xmin, rep xmax)
+  {
+    const std::size_t n = std::max<std::size_t>(nw, 1);
+    const rep delta = (xmax - xmin) / static_cast<rep>(n);
+    std::vector<rep> b;
+    b.reserve(n + 1);
+    for (std::size_t k = 0; k <= n; ++k) b.push_back(xmin + static_cast<rep>(k) * delta);
+    return b;
+  }
+
+  template<typename Weights>
+  alias_piecewise_distribution(from_boundaries_t, std::vector<rep> b, Weights w) : intervals_(std::move(b))
+  {
+    // the weights of the boundaries (linear) or of the intervals (constant)
+    std::vector<double> weights;
+    if (intervals_.size() < 2) {
+      // fewer than 2 boundaries mean the default [0, 1) interval and the weights are not read
+      intervals_ = {0, 1};
+      weights.assign(Linear ? 2 : 1, 1.);
+    } else
+      for (std::size_t k = 0; k < (Linear ? intervals_.size() : intervals_.size() - 1); ++k) {
+        if constexpr (std::is_invocable_v<Weights, Q>) {
+          const rep x = Linear ? intervals_[k] : rep{0.5} * (intervals_[k + 1] + intervals_[k]);
+          weights.push_back(static_cast<double>(w(x * Q::reference)));
+        } else if constexpr (std::ranges::range<Weights>)
+          weights.push_back(static_cast<double>(w[k]));
+        else
+          weights.push_back(static_cast<double>(*w++));
+      }
+
+    const std::size_t n = intervals_.size() - 1;
+
+    std::vector<double> masses(n);
+    for (std::size_t k = 0; k < n; ++k) {
+      const auto width = static_cast<double>(intervals_[k + 1] - intervals_[k]);
+      masses[k] = Linear ? 0.5 * (weights[k] + weights[k + 1]) * width : weights[k];
+    }
+    table_ = alias_table(masses);
+
+    double sum = 0;
+    for (double m : masses) sum += m;
+    densities_.resize(weights.size());
+    for (std::size_t k = 0; k < weights.size(); ++k)
+      densities_[k] = Linear ? weights[k] / sum
+                             : weights[k] / (sum * static_cast<double>(intervals_[k + 1] - intervals_[k]));
+  }
+
+  [[nodiscard]] rep sample(double u1, rep u2) const noexcept
+  {
+    const std::size_t k = table_(u1);
+    const rep lo = intervals_[k];
+    const rep width = intervals_[k + 1] - lo;
+    if constexpr (Linear) {
+      // inverse of the CDF of the trapezoid in the form stable also for equal densities
+      const auto a = static_cast<rep>(densities_[k]);
+      const auto b = static_cast<rep>(densities_[k + 1]);
+      const rep den = a + std::sqrt(a * a + u2 * (b * b - a * a));
+      return den > 0 ? lo + width * (u2 * (a + b) / den) : lo + width * u2;
+    } else
+      return lo + width * u2;
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A piecewise constant distribution sampled with an alias table in O(1)
+ */
+template<Quantity Q>
+  requires std::floating_point<typename Q::rep>
+class alias_piecewise_constant_distribution :
+    public detail::alias_piecewise_distribution<alias_piecewise_constant_distribution<Q>, Q, false> {
+  using base = detail::alias_piecewise_distribution<alias_piecewise_constant_distribution<Q>, Q, false>;
+
+public:
+  using base::base;
+};
+
+/**
+ * @brief A piecewise linear distribution sampled with an alias table in O(1)
+ */
+template<Quantity Q>
+  requires std::floating_point<typename Q::rep>
+class alias_piecewise_linear_distribution :
+    public detail::alias_piecewise_distribution<alias_piecewise_linear_distribution<Q>, Q, true> {
+  using base = detail::alias_piecewise_distribution<alias_piecewise_linear_distribution<Q>, Q, true>;
+
+public:
+  using base::base;
 };
 
 }  // namespace mp_units
@@ -0,0 +1,267 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/value_cast.h>
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_point.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <gsl/gsl-lite.hpp>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace mp_units {
+
+namespace detail {
+
+template<typename Rep>
+using rate_calc_rep = std::conditional_t<treat_as_floating_point<Rep>, Rep, double>;
+
+/**
+ * @brief Returns the index of a period of length `width` that contains `t`
+ *
+ * Periods are counted from the absolute point origin of the time point.
+ */
+template<QuantityPoint TP>
+[[nodiscard]] std::int64_t period_index(const TP& t, const typename TP::quantity_type& width)
+{
+  const auto n = (t - TP::absolute_point_origin).numerical_value_in(TP::unit);
+  const auto w = width.numerical_value_in(TP::unit);
+  if constexpr (treat_as_floating_point<typename TP::rep>)
+    return static_cast<std::int64_t>(std::floor(n / w));
+  else
+    return static_cast<std::int64_t>(n >= 0 ? n / w : (n - w + 1) / w);
+}
+
+}  // namespace detail
+
+/**
+ * @brief A sliding window rate meter
+ *
+ * Accumulates amounts (e.g. bytes or requests) recorded at given time points and reports the rate
+ * at which they arrive over a sliding window. The window is divided into `Buckets` buckets so that
+ * recording is O(1) and the window slides with a bucket granularity.
+ *
+ * `record()` has to be called from one thread at a time with non-decreasing time points while
+ * `rate()` and `total()` may be called concurrently from any number of threads. Readers never block
+ * the writer (the state is published with a sequence lock built on atomics), and all the operations
+ * are lock-free as long as `std::atomic<typename Q::rep>` is lock-free.
+ *
+ * @code{.cpp}
+ * rate_meter<timestamp, quantity<iec80000::byte, std::int64_t>> meter(1 * s);
+ * meter.record(clock::now(), message.size() * iec80000::byte);
+ * // ...
+ * quantity<iec80000::byte / si::second> throughput = meter.rate(clock::now());
+ * @endcode
+ *
+ * @tparam TimePoint a quantity point of time of the samples
+ * @tparam Q a quantity type of the recorded amounts
+ * @tparam Buckets the number of buckets in the window
+ */
+template<QuantityPointOf<isq::time> TimePoint, Quantity Q, std::size_t Buckets = 16>
+  requires(Buckets >= 2)
+class rate_meter {
+  using rep = MP_UNITS_TYPENAME Q::rep;
+  using calc_rep = detail::rate_calc_rep<rep>;
+  static constexpr auto bucket_count = static_cast<std::int64_t>(Buckets);
+
+public:
+  using time_point = TimePoint;
+  using duration = MP_UNITS_TYPENAME TimePoint::quantity_type;
+  using quantity_type = Q;
+  using rate_type = decltype(std::declval<quantity<Q::reference, calc_rep>>() /
+                             std::declval<quantity<duration::reference, calc_rep>>());
+
+  static constexpr bool is_always_lock_free =
+    std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::int64_t>::is_always_lock_free &&
+    std::atomic<rep>::is_always_lock_free && std::atomic<typename TimePoint::rep>::is_always_lock_free;
+
+  /**
+   * @brief Creates a meter with a sliding window of a given length
+   *
+   * @param window the length of the window (has to be a multiple of `Buckets` ticks of `duration`)
+   */
+  explicit rate_meter(const duration& window) : bucket_width_(window / static_cast<duration::rep>(Buckets))
+  {
+    gsl_Expects(bucket_width_ > duration::zero());
+  }
+
+  rate_meter(const rate_meter&) = delete;
+  rate_meter& operator=(const rate_meter&) = delete;
+
+  [[nodiscard]] duration window() const noexcept { return bucket_width_ * static_cast<duration::rep>(Buckets); }
+
+  /**
+   * @brief Records an amount arriving at `t` (single writer)
+   */
+  void record(const time_point& t, const quantity_type& amount)
+  {
+    const std::int64_t index = detail::period_index(t, bucket_width_);
+    bucket& b = buckets_[static_cast<std::size_t>((index % bucket_count + bucket_count) % bucket_count)];
+    const std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    if (b.index.load(std::memory_order_relaxed) == index)
+      b.sum.store(b.sum.load(std::memory_order_relaxed) + amount.numerical_value(), std::memory_order_relaxed);
+    else {
+      b.index.store(index, std::memory_order_relaxed);
+      b.sum.store(amount.numerical_value(), std::memory_order_relaxed);
+    }
+    total_.store(total_.load(std::memory_order_relaxed) + amount.numerical_value(), std::memory_order_relaxed);
+    latest_.store(t.quantity_from_origin().numerical_value(), std::memory_order_relaxed);
+    seq_.store(seq + 2, std::memory_order_release);
+  }
+
+  /**
+   * @brief The total amount recorded so far
+   */
+  [[nodiscard]] quantity_type total() const noexcept
+  {
+    return make_quantity<Q::reference>(total_.load(std::memory_order_relaxed));
+  }
+
+  /**
+   * @brief The rate of the amounts recorded within the window ending at `now`
+   *
+   * If `now` is earlier than the latest record the window ends at the time of that record instead.
+   * The current bucket is taken into account only up to `now`, so the rate is not underestimated
+   * at the beginning of a bucket.
+   */
+  [[nodiscard]] rate_type rate(const time_point& now) const noexcept
+  {
+    time_point end;
+    std::int64_t current = 0;
+    calc_rep sum{};
+    std::uint64_t seq_begin = 0;
+    do {
+      seq_begin = seq_.load(std::memory_order_acquire);
+      const time_point latest =
+        TimePoint::point_origin + make_quantity<TimePoint::reference>(latest_.load(std::memory_order_relaxed));
+      end = latest < now ? now : latest;
+      current = detail::period_index(end, bucket_width_);
+      sum = calc_rep{};
+      for (const bucket& b : buckets_) {
+        const std::int64_t index = b.index.load(std::memory_order_relaxed);
+        if (index <= current && index > current - bucket_count)
+          sum += static_cast<calc_rep>(b.sum.load(std::memory_order_relaxed));
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((seq_begin & 1) != 0 || seq_begin != seq_.load(std::memory_order_relaxed));
+
+    const duration current_start = bucket_width_ * static_cast<duration::rep>(current);
+    const duration elapsed = bucket_width_ * static_cast<duration::rep>(Buckets - 1) +
+                             ((end - TimePoint::absolute_point_origin) - current_start);
+    return make_quantity<Q::reference>(sum) / value_cast<calc_rep>(elapsed);
+  }
+
+private:
+  struct bucket {
+    std::atomic<std::int64_t> index{std::numeric_limits<std::int64_t>::min()};
+    std::atomic<rep> sum{};
+  };
+
+  duration bucket_width_;
+  std::atomic<std::uint64_t> seq_{0};
+  std::atomic<rep> total_{};
+  std::atomic<typename TimePoint::rep> latest_{};
+  std::array<bucket, Buckets> buckets_{};
+};
+
+/**
+ * @brief An exponentially weighted moving average of irregularly sampled quantities
+ *
+ * Each sample is weighted with `1 - exp(-dt / tau)` where `dt` is the time elapsed since the previous
+ * sample, so the result does not depend on the sampling frequency. The first sample initializes
+ * the average.
+ *
+ * `update()` has to be called from one thread at a time with non-decreasing time points while
+ * `value()` may be called concurrently from any number of threads. All the operations are lock-free
+ * as long as `std::atomic` of the calculation representation type is lock-free.
+ *
+ * @tparam TimePoint a quantity point of time of the samples
+ * @tparam Q a quantity type of the samples (e.g. a rate)
+ */
+template<QuantityPointOf<isq::time> TimePoint, Quantity Q>
+class ewma {
+  using calc_rep = detail::rate_calc_rep<typename Q::rep>;
+
+public:
+  using time_point = TimePoint;
+  using duration = MP_UNITS_TYPENAME TimePoint::quantity_type;
+  using value_type = quantity<Q::reference, calc_rep>;
+
+  static constexpr bool is_always_lock_free = std::atomic<calc_rep>::is_always_lock_free;
+
+  /**
+   * @brief Creates an average with a given time constant
+   *
+   * @param tau the time after which the weight of a sample drops to `1/e`
+   */
+  explicit ewma(const duration& tau) : tau_(value_cast<calc_rep>(tau)) { gsl_Expects(tau > duration::zero()); }
+
+  ewma(const ewma&) = delete;
+  ewma& operator=(const ewma&) = delete;
+
+  /**
+   * @brief Adds a sample taken at `t` (single writer)
+   */
+  void update(const time_point& t, const Q& sample)
+  {
+    const value_type v = value_cast<calc_rep>(sample);
+    if (!initialized_) {
+      initialized_ = true;
+      current_ = v;
+    } else {
+      gsl_Expects(last_ <= t);
+      using std::exp;
+      const calc_rep alpha = calc_rep{1} - exp(-(value_cast<calc_rep>(t - last_) / tau_).numerical_value_in(one));
+      current_ += (v - current_) * alpha;
+    }
+    last_ = t;
+    value_.store(current_.numerical_value(), std::memory_order_release);
+  }
+
+  /**
+   * @brief The current value of the average (zero before the first sample)
+   */
+  [[nodiscard]] value_type value() const noexcept
+  {
+    return make_quantity<Q::reference>(value_.load(std::memory_order_acquire));
+  }
+
+private:
+  quantity<duration::reference, calc_rep> tau_;
+  // writer state
+  bool initialized_ = false;
+  time_point last_{};
+  value_type current_{};
+  // published state
+  std::atomic<calc_rep> value_{};
+};
+
+}  // namespace mp_units
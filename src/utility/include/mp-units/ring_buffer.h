@@ -0,0 +1,303 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/atomic.h>
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_point.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace mp_units {
+
+namespace detail {
+
+struct cache_aligned_deleter {
+  template<typename T>
+  void operator()(T* ptr) const noexcept
+  {
+    ::operator delete[](ptr, std::align_val_t{cache_line_size});
+  }
+};
+
+template<typename T>
+using cache_aligned_array = std::unique_ptr<T[], cache_aligned_deleter>;
+
+template<typename T>
+[[nodiscard]] cache_aligned_array<T> make_cache_aligned_array(std::size_t size)
+{
+  static_assert(std::is_trivially_destructible_v<T>);
+  auto* ptr = static_cast<T*>(::operator new[](size * sizeof(T), std::align_val_t{cache_line_size}));
+  std::uninitialized_value_construct_n(ptr, size);
+  return cache_aligned_array<T>(ptr);
+}
+
+template<typename T>
+concept RingBufferValue = (Quantity<T> || QuantityPoint<T>) && std::is_trivially_copyable_v<T> &&
+                          std::is_trivially_copyable_v<typename T::rep>;
+
+template<typename U, typename T>
+concept ConvertibleToRingBufferValue = (Quantity<U> || QuantityPoint<U>) && std::convertible_to<const U&, T>;
+
+}  // namespace detail
+
+/**
+ * @brief A bounded lock-free single-producer single-consumer queue of quantities or quantity points
+ *
+ * Only the numerical values in the unit of `T` are stored (in cache-aligned storage). Values
+ * in other units are converted by the producer before they are enqueued.
+ *
+ * @tparam T a quantity or a quantity point type
+ */
+template<detail::RingBufferValue T>
+class spsc_ring_buffer {
+  using traits = detail::atomic_quantity_traits<T>;
+  using rep = MP_UNITS_TYPENAME T::rep;
+  static_assert(sizeof(T) == sizeof(rep), "a quantity is expected to store only its numerical value");
+
+public:
+  using value_type = T;
+
+  /**
+   * @brief Creates a buffer for at least `capacity` values (rounded up to a power of 2)
+   */
+  explicit spsc_ring_buffer(std::size_t capacity) :
+      mask_(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1),
+      values_(detail::make_cache_aligned_array<rep>(mask_ + 1))
+  {
+  }
+
+  spsc_ring_buffer(const spsc_ring_buffer&) = delete;
+  spsc_ring_buffer& operator=(const spsc_ring_buffer&) = delete;
+
+  [[nodiscard]] std::size_t capacity() const noexcept { return mask_ + 1; }
+
+  /**
+   * @brief The number of the values in the buffer (exact only if neither of the threads modifies the buffer)
+   */
+  [[nodiscard]] std::size_t size() const noexcept
+  {
+    // `head_` never passes `tail_`, so loading it first never results in a negative (wrapped) size
+    const std::size_t head = head_.load(std::memory_order_acquire);
+    const std::size_t tail = tail_.load(std::memory_order_acquire);
+    return std::min(tail - head, capacity());
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+  // producer
+
+  bool try_push(const T& value) noexcept { return try_push(std::span<const T>(&value, 1)) == 1; }
+
+  /**
+   * @brief Enqueues as many of the values as fit in the buffer and returns their number
+   */
+  std::size_t try_push(std::span<const T> values) noexcept { return try_push<T>(values); }
+
+  /**
+   * @brief Enqueues as many of the values as fit in the buffer and returns their number
+   *
+   * The values are converted to the unit of `T` while they are written to the buffer.
+   */
+  template<detail::ConvertibleToRingBufferValue<T> U>
+  std::size_t try_push(std::span<const U> values) noexcept(std::is_nothrow_convertible_v<const U&, T>)
+  {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (capacity() - (tail - cached_head_) < values.size())
+      cached_head_ = head_.load(std::memory_order_acquire);
+    const std::size_t count = std::min(values.size(), capacity() - (tail - cached_head_));
+    for_each_segment(tail, count, [&](rep* dest, std::size_t offset, std::size_t n) {
+      std::ranges::transform(values.subspan(offset, n), dest, [](const U& v) { return traits::numerical_value(T(v)); });
+    });
+    tail_.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  // consumer
+
+  [[nodiscard]] std::optional<T> try_pop() noexcept
+  {
+    std::optional<T> res;
+    T value;
+    if (try_pop(std::span<T>(&value, 1)) == 1) res = value;
+    return res;
+  }
+
+  /**
+   * @brief Dequeues up to `out.size()` values into `out` and returns their number
+   */
+  std::size_t try_pop(std::span<T> out) noexcept
+  {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    if (cached_tail_ - head < out.size()) cached_tail_ = tail_.load(std::memory_order_acquire);
+    const std::size_t count = std::min(out.size(), cached_tail_ - head);
+    for_each_segment(head, count, [&](rep* src, std::size_t offset, std::size_t n) {
+      std::transform(src, src + n, out.begin() + static_cast<std::ptrdiff_t>(offset),
+                     [](rep v) { return traits::make(v); });
+    });
+    head_.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+private:
+  // consumer
+  alignas(detail::cache_line_size) std::atomic<std::size_t> head_{0};
+  std::size_t cached_tail_ = 0;
+  // producer
+  alignas(detail::cache_line_size) std::atomic<std::size_t> tail_{0};
+  std::size_t cached_head_ = 0;
+  // shared
+  alignas(detail::cache_line_size) const std::size_t mask_;
+  detail::cache_aligned_array<rep> values_;
+
+  // calls `func` for the (at most two) contiguous parts of `count` slots starting at the position `pos`
+  template<typename Func>
+  void for_each_segment(std::size_t pos, std::size_t count, Func func) const noexcept
+  {
+    const std::size_t first = pos & mask_;
+    const std::size_t n = std::min(count, capacity() - first);
+    func(values_.get() + first, 0, n);
+    if (n < count) func(values_.get(), n, count - n);
+  }
+};
+
+/**
+ * @brief A bounded lock-free multi-producer multi-consumer queue of quantities or quantity points
+ *
+ * Every slot has a sequence number telling whether it is ready to be written or read, so
+ * producers and consumers only contend for the position counters (D. Vyukov's bounded queue).
+ * Only the numerical values in the unit of `T` are stored (in cache-aligned storage).
+ *
+ * @tparam T a quantity or a quantity point type
+ */
+template<detail::RingBufferValue T>
+class mpmc_ring_buffer {
+  using traits = detail::atomic_quantity_traits<T>;
+  using rep = MP_UNITS_TYPENAME T::rep;
+  static_assert(sizeof(T) == sizeof(rep), "a quantity is expected to store only its numerical value");
+
+public:
+  using value_type = T;
+
+  /**
+   * @brief Creates a buffer for at least `capacity` values (rounded up to a power of 2)
+   */
+  explicit mpmc_ring_buffer(std::size_t capacity) :
+      mask_(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1),
+      sequences_(detail::make_cache_aligned_array<std::atomic<std::size_t>>(mask_ + 1)),
+      values_(detail::make_cache_aligned_array<rep>(mask_ + 1))
+  {
+    for (std::size_t i = 0; i <= mask_; ++i) sequences_[i].store(i, std::memory_order_relaxed);
+  }
+
+  mpmc_ring_buffer(const mpmc_ring_buffer&) = delete;
+  mpmc_ring_buffer& operator=(const mpmc_ring_buffer&) = delete;
+
+  [[nodiscard]] std::size_t capacity() const noexcept { return mask_ + 1; }
+
+  bool try_push(const T& value) noexcept
+  {
+    std::size_t pos = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      const std::size_t seq = sequences_[pos & mask_].load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (diff < 0)
+        return false;  // full
+      else
+        pos = tail_.load(std::memory_order_relaxed);
+    }
+    values_[pos & mask_] = traits::numerical_value(value);
+    sequences_[pos & mask_].store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Enqueues values until the buffer is full and returns their number
+   */
+  std::size_t try_push(std::span<const T> values) noexcept { return try_push<T>(values); }
+
+  /**
+   * @brief Enqueues values until the buffer is full and returns their number
+   *
+   * The values are converted to the unit of `T` while they are written to the buffer.
+   */
+  template<detail::ConvertibleToRingBufferValue<T> U>
+  std::size_t try_push(std::span<const U> values) noexcept(std::is_nothrow_convertible_v<const U&, T>)
+  {
+    std::size_t count = 0;
+    while (count < values.size() && try_push(T(values[count]))) ++count;
+    return count;
+  }
+
+  [[nodiscard]] std::optional<T> try_pop() noexcept
+  {
+    std::size_t pos = head_.load(std::memory_order_relaxed);
+    while (true) {
+      const std::size_t seq = sequences_[pos & mask_].load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (diff < 0)
+        return std::nullopt;  // empty
+      else
+        pos = head_.load(std::memory_order_relaxed);
+    }
+    const rep value = values_[pos & mask_];
+    sequences_[pos & mask_].store(pos + mask_ + 1, std::memory_order_release);
+    return traits::make(value);
+  }
+
+  /**
+   * @brief Dequeues up to `out.size()` values into `out` and returns their number
+   */
+  std::size_t try_pop(std::span<T> out) noexcept
+  {
+    std::size_t count = 0;
+    for (; count < out.size(); ++count) {
+      const std::optional<T> value = try_pop();
+      if (!value) break;
+      out[count] = *value;
+    }
+    return count;
+  }
+
+private:
+  alignas(detail::cache_line_size) std::atomic<std::size_t> head_{0};
+  alignas(detail::cache_line_size) std::atomic<std::size_t> tail_{0};
+  alignas(detail::cache_line_size) const std::size_t mask_;
+  detail::cache_aligned_array<std::atomic<std::size_t>> sequences_;
+  detail::cache_aligned_array<rep> values_;
+};
+
+}  // namespace mp_units
@@ -0,0 +1,306 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/value_cast.h>
+#include <mp-units/linear_algebra.h>
+#include <mp-units/quantity.h>
+#include <mp-units/systems/angular/angular.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/units.h>
+#include <gsl/gsl-lite.hpp>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace mp_units {
+
+namespace detail {
+
+template<typename Q>
+concept AngleQuantity = QuantityOf<Q, isq::angular_measure> || QuantityOf<Q, angular::angle>;
+
+template<std::floating_point T, AngleQuantity Q>
+[[nodiscard]] constexpr T radians(const Q& angle)
+{
+  if constexpr (QuantityOf<Q, isq::angular_measure>)
+    return value_cast<T>(angle).numerical_value_in(si::radian);
+  else
+    return value_cast<T>(angle).numerical_value_in(angular::radian);
+}
+
+}  // namespace detail
+
+/**
+ * @brief A unit quaternion representing a rotation in the 3-dimensional space
+ *
+ * The angles may be provided as quantities of both `isq::angular_measure` (e.g. `si::radian`,
+ * `si::degree`) and `angular::angle` (e.g. `angular::degree`). A rotation applied to a `vec`
+ * quantity keeps its reference, so rotating an `isq::velocity[m / s]` gives an
+ * `isq::velocity[m / s]`:
+ *
+ * @code{.cpp}
+ * const auto attitude = quaternion<double>::from_euler(30 * deg, 5 * deg, 0 * deg);
+ * quantity<isq::velocity[m / s], vec<3, double>> v_ned = attitude * v_body;
+ * @endcode
+ *
+ * Rotations are composed with `operator*` (`(a * b) * v == a * (b * v)`).
+ */
+template<std::floating_point T>
+class quaternion {
+public:
+  using value_type = T;
+
+  constexpr quaternion() = default;
+  constexpr quaternion(T w, T x, T y, T z) : w_(w), x_(x), y_(y), z_(z) {}
+
+  [[nodiscard]] static constexpr quaternion identity() { return {}; }
+
+  /**
+   * @brief The rotation by `angle` about `axis` (right-hand rule)
+   */
+  template<detail::AngleQuantity A>
+  [[nodiscard]] static quaternion from_axis_angle(const vec<3, T>& axis, const A& angle)
+  {
+    const T length = mp_units::norm(axis);
+    gsl_Expects(length > 0);
+    const T half = detail::radians<T>(angle) / 2;
+    const vec<3, T> u = axis * (std::sin(half) / length);
+    return {std::cos(half), u[0], u[1], u[2]};
+  }
+
+  /**
+   * @brief The rotation from the body frame to the reference frame given by the aerospace
+   * (Z-Y-X intrinsic) sequence of yaw, pitch, and roll angles
+   */
+  template<detail::AngleQuantity Yaw, detail::AngleQuantity Pitch, detail::AngleQuantity Roll>
+  [[nodiscard]] static quaternion from_euler(const Yaw& yaw, const Pitch& pitch, const Roll& roll)
+  {
+    const T cy = std::cos(detail::radians<T>(yaw) / 2), sy = std::sin(detail::radians<T>(yaw) / 2);
+    const T cp = std::cos(detail::radians<T>(pitch) / 2), sp = std::sin(detail::radians<T>(pitch) / 2);
+    const T cr = std::cos(detail::radians<T>(roll) / 2), sr = std::sin(detail::radians<T>(roll) / 2);
+    return {cr * cp * cy + sr * sp * sy, sr * cp * cy - cr * sp * sy, cr * sp * cy + sr * cp * sy,
+            cr * cp * sy - sr * sp * cy};
+  }
+
+  [[nodiscard]] constexpr T w() const { return w_; }
+  [[nodiscard]] constexpr T x() const { return x_; }
+  [[nodiscard]] constexpr T y() const { return y_; }
+  [[nodiscard]] constexpr T z() const { return z_; }
+
+  [[nodiscard]] constexpr quaternion conjugate() const { return {w_, -x_, -y_, -z_}; }
+
+  /**
+   * @brief The inverse rotation (the conjugate of a unit quaternion)
+   */
+  [[nodiscard]] constexpr quaternion inverse() const { return conjugate(); }
+
+  [[nodiscard]] T norm() const { return std::sqrt(w_ * w_ + x_ * x_ + y_ * y_ + z_ * z_); }
+
+  /**
+   * @brief Removes the drift of the norm accumulated by long chains of compositions
+   */
+  [[nodiscard]] quaternion normalized() const
+  {
+    const T n = norm();
+    gsl_Expects(n > 0);
+    return {w_ / n, x_ / n, y_ / n, z_ / n};
+  }
+
+  /**
+   * @brief The angle of the rotation in [0, 2π]
+   */
+  [[nodiscard]] quantity<si::radian, T> angle() const
+  {
+    return 2 * std::atan2(std::sqrt(x_ * x_ + y_ * y_ + z_ * z_), w_) * si::radian;
+  }
+
+  /**
+   * @brief The equivalent rotation matrix
+   *
+   * Rotating many vectors with a matrix takes fewer operations than with a quaternion.
+   */
+  [[nodiscard]] constexpr mat<3, 3, T> to_matrix() const
+  {
+    const T xx = x_ * x_, yy = y_ * y_, zz = z_ * z_;
+    const T xy = x_ * y_, xz = x_ * z_, yz = y_ * z_;
+    const T wx = w_ * x_, wy = w_ * y_, wz = w_ * z_;
+    return {{1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy)},
+            {2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx)},
+            {2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy)}};
+  }
+
+  /**
+   * @brief The composition of rotations (`rhs` is applied first)
+   */
+  [[nodiscard]] friend constexpr quaternion operator*(const quaternion& lhs, const quaternion& rhs)
+  {
+    return {lhs.w_ * rhs.w_ - lhs.x_ * rhs.x_ - lhs.y_ * rhs.y_ - lhs.z_ * rhs.z_,
+            lhs.w_ * rhs.x_ + lhs.x_ * rhs.w_ + lhs.y_ * rhs.z_ - lhs.z_ * rhs.y_,
+            lhs.w_ * rhs.y_ - lhs.x_ * rhs.z_ + lhs.y_ * rhs.w_ + lhs.z_ * rhs.x_,
+            lhs.w_ * rhs.z_ + lhs.x_ * rhs.y_ - lhs.y_ * rhs.x_ + lhs.z_ * rhs.w_};
+  }
+
+  /**
+   * @brief Rotates a vector
+   *
+   * Uses `v' = v + w t + u × t` with `t = 2 u × v` (15 multiplications and 15 additions).
+   */
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator*(const quaternion& q, const vec<3, U>& v)
+  {
+    using R = std::common_type_t<T, U>;
+    const R tx = 2 * (q.y_ * v[2] - q.z_ * v[1]);
+    const R ty = 2 * (q.z_ * v[0] - q.x_ * v[2]);
+    const R tz = 2 * (q.x_ * v[1] - q.y_ * v[0]);
+    return vec<3, R>{v[0] + q.w_ * tx + (q.y_ * tz - q.z_ * ty), v[1] + q.w_ * ty + (q.z_ * tx - q.x_ * tz),
+                     v[2] + q.w_ * tz + (q.x_ * ty - q.y_ * tx)};
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const quaternion&, const quaternion&) = default;
+
+private:
+  T w_ = 1;
+  T x_ = 0;
+  T y_ = 0;
+  T z_ = 0;
+};
+
+/**
+ * @brief Composes the rotations from right to left (the last one is applied first)
+ *
+ * The result is normalized once instead of after every product.
+ */
+template<std::floating_point T, std::same_as<quaternion<T>>... Qs>
+[[nodiscard]] quaternion<T> compose(const quaternion<T>& first, const Qs&... rest)
+{
+  return (first * ... * rest).normalized();
+}
+
+/**
+ * @brief Vectors of the same quantity stored as separate arrays of their components
+ *
+ * The structure of arrays layout lets the batched operations process the components of many
+ * vectors with whole SIMD registers. The elements are read and written as `vec` quantities.
+ */
+template<Reference auto R, std::floating_point T = double>
+  requires RepresentationOf<vec<3, T>, get_quantity_spec(R).character>
+class vector_array {
+public:
+  using value_type = quantity<R, vec<3, T>>;
+
+  vector_array() = default;
+  explicit vector_array(std::size_t size) : x_(size), y_(size), z_(size) {}
+
+  [[nodiscard]] std::size_t size() const { return x_.size(); }
+  [[nodiscard]] bool empty() const { return x_.empty(); }
+
+  void resize(std::size_t size)
+  {
+    x_.resize(size);
+    y_.resize(size);
+    z_.resize(size);
+  }
+
+  void push_back(const value_type& v)
+  {
+    const vec<3, T>& n = v.numerical_value();
+    x_.push_back(n[0]);
+    y_.push_back(n[1]);
+    z_.push_back(n[2]);
+  }
+
+  [[nodiscard]] value_type operator[](std::size_t i) const
+  {
+    return make_quantity<R>(vec<3, T>{x_[i], y_[i], z_[i]});
+  }
+
+  void set(std::size_t i, const value_type& v)
+  {
+    const vec<3, T>& n = v.numerical_value();
+    x_[i] = n[0];
+    y_[i] = n[1];
+    z_[i] = n[2];
+  }
+
+  /**
+   * @brief The numerical values of the components in the unit of `R`
+   */
+  [[nodiscard]] std::span<T> x() { return x_; }
+  [[nodiscard]] std::span<T> y() { return y_; }
+  [[nodiscard]] std::span<T> z() { return z_; }
+  [[nodiscard]] std::span<const T> x() const { return x_; }
+  [[nodiscard]] std::span<const T> y() const { return y_; }
+  [[nodiscard]] std::span<const T> z() const { return z_; }
+
+private:
+  std::vector<T> x_;
+  std::vector<T> y_;
+  std::vector<T> z_;
+};
+
+/**
+ * @brief Applies the linear transformation `m` to the vectors given by the components
+ *
+ * Writes to `out_x`, `out_y`, and `out_z` that may alias the inputs.
+ */
+template<std::floating_point T>
+void transform_vectors(const mat<3, 3, T>& m, std::span<const T> x, std::span<const T> y, std::span<const T> z,
+                       std::span<T> out_x, std::span<T> out_y, std::span<T> out_z)
+{
+  gsl_Expects(y.size() == x.size() && z.size() == x.size());
+  gsl_Expects(out_x.size() == x.size() && out_y.size() == x.size() && out_z.size() == x.size());
+  const T m00 = m(0, 0), m01 = m(0, 1), m02 = m(0, 2);
+  const T m10 = m(1, 0), m11 = m(1, 1), m12 = m(1, 2);
+  const T m20 = m(2, 0), m21 = m(2, 1), m22 = m(2, 2);
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    const T vx = x[i], vy = y[i], vz = z[i];
+    out_x[i] = m00 * vx + m01 * vy + m02 * vz;
+    out_y[i] = m10 * vx + m11 * vy + m12 * vz;
+    out_z[i] = m20 * vx + m21 * vy + m22 * vz;
+  }
+}
+
+/**
+ * @brief Rotates all the vectors of `in` and writes them to `out` (that may be `in`)
+ *
+ * The quaternion is converted to a rotation matrix once, and the components are processed as
+ * separate arrays, so the loop is vectorized by the compiler.
+ */
+template<std::floating_point T, Reference auto R>
+void rotate(const quaternion<T>& q, const vector_array<R, T>& in, vector_array<R, T>& out)
+{
+  if (&out != &in) out.resize(in.size());
+  transform_vectors(q.to_matrix(), in.x(), in.y(), in.z(), out.x(), out.y(), out.z());
+}
+
+template<std::floating_point T, Reference auto R>
+void rotate(const quaternion<T>& q, vector_array<R, T>& v)
+{
+  rotate(q, v, v);
+}
+
+}  // namespace mp_units
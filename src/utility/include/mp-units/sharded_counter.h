@@ -0,0 +1,160 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/atomic.h>
+#include <mp-units/quantity.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace mp_units {
+
+namespace detail {
+
+/**
+ * @brief A small number unique to the calling thread (assigned in the order of the first call)
+ */
+[[nodiscard]] inline std::size_t this_thread_ordinal() noexcept
+{
+  static std::atomic<std::size_t> next{0};
+  thread_local const std::size_t ordinal = next.fetch_add(1, std::memory_order_relaxed);
+  return ordinal;
+}
+
+}  // namespace detail
+
+/**
+ * @brief A counter of quantities sharded between threads
+ *
+ * Every thread adds to its own cache-line-sized slot, so frequent updates from many cores do not
+ * contend for a single cache line. Reading the counter sums all the slots; the result is
+ * not a snapshot of a single moment but every completed update is included in it.
+ *
+ * @code{.cpp}
+ * sharded_counter<quantity<iec80000::byte, std::uint64_t>> received;
+ * // on the hot path of any thread
+ * received += packet.size() * B;
+ * // occasionally
+ * quantity<iec80000::bit, std::uint64_t> total = received.load_in(iec80000::bit);
+ * @endcode
+ *
+ * @tparam Q a quantity type of the counter
+ */
+template<Quantity Q>
+class sharded_counter {
+  struct alignas(detail::cache_line_size) slot {
+    atomic_quantity<Q> value;
+  };
+
+public:
+  using value_type = Q;
+
+  /**
+   * @brief The default number of slots (a power of 2 not smaller than the number of hardware threads)
+   */
+  [[nodiscard]] static std::size_t default_shards() noexcept
+  {
+    return std::bit_ceil(std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+  }
+
+  explicit sharded_counter(std::size_t shards = default_shards()) :
+      slots_(std::make_unique<slot[]>(shards)), shards_(shards)
+  {
+    gsl_Expects(shards > 0);
+  }
+
+  sharded_counter(const sharded_counter&) = delete;
+  sharded_counter& operator=(const sharded_counter&) = delete;
+
+  [[nodiscard]] std::size_t shards() const noexcept { return shards_; }
+
+  /**
+   * @brief Adds a quantity to the slot of the calling thread
+   *
+   * An argument in a different unit is converted to the unit of `Q` before the update.
+   */
+  void add(const Q& q, std::memory_order order = std::memory_order_relaxed) noexcept
+  {
+    local().fetch_add(q, order);
+  }
+
+  void sub(const Q& q, std::memory_order order = std::memory_order_relaxed) noexcept
+  {
+    local().fetch_sub(q, order);
+  }
+
+  sharded_counter& operator+=(const Q& q) noexcept
+  {
+    add(q);
+    return *this;
+  }
+
+  sharded_counter& operator-=(const Q& q) noexcept
+  {
+    sub(q);
+    return *this;
+  }
+
+  /**
+   * @brief Returns the sum of all the slots
+   */
+  [[nodiscard]] Q load(std::memory_order order = std::memory_order_relaxed) const noexcept
+  {
+    Q sum = Q::zero();
+    for (std::size_t i = 0; i < shards_; ++i) sum += slots_[i].value.load(order);
+    return sum;
+  }
+
+  /**
+   * @brief Returns the sum of all the slots in the unit `U`
+   */
+  template<Unit U>
+  [[nodiscard]] auto load_in(U u, std::memory_order order = std::memory_order_relaxed) const noexcept
+  {
+    return load(order).in(u);
+  }
+
+  /**
+   * @brief Clears all the slots (concurrent updates may or may not be preserved)
+   */
+  void reset() noexcept
+  {
+    for (std::size_t i = 0; i < shards_; ++i) slots_[i].value.store(Q::zero(), std::memory_order_relaxed);
+  }
+
+private:
+  std::unique_ptr<slot[]> slots_;
+  std::size_t shards_;
+
+  [[nodiscard]] atomic_quantity<Q>& local() noexcept
+  {
+    return slots_[detail::this_thread_ordinal() % shards_].value;
+  }
+};
+
+}  // namespace mp_units
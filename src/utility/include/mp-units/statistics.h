@@ -0,0 +1,317 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/value_cast.h>
+#include <mp-units/math.h>
+#include <mp-units/quantity.h>
+#include <gsl/gsl-lite.hpp>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace mp_units {
+
+namespace detail {
+
+template<typename Rep>
+using statistics_calc_rep = std::conditional_t<treat_as_floating_point<Rep>, Rep, double>;
+
+// number of independent accumulators used by the bulk operations (allows the compiler to vectorize
+// floating-point reductions without reassociating them)
+inline constexpr std::size_t statistics_lanes = 8;
+
+template<typename T, Quantity Q>
+[[nodiscard]] constexpr T sum_values(std::span<const Q> xs)
+{
+  std::array<T, statistics_lanes> acc{};
+  std::size_t i = 0;
+  for (; i + statistics_lanes <= xs.size(); i += statistics_lanes)
+    for (std::size_t j = 0; j < statistics_lanes; ++j) acc[j] += static_cast<T>(xs[i + j].numerical_value());
+  for (; i < xs.size(); ++i) acc[0] += static_cast<T>(xs[i].numerical_value());
+  T sum{};
+  for (const T& a : acc) sum += a;
+  return sum;
+}
+
+// the sum of products of the deviations from the given means (values of `xs` and `ys` are expressed in the units
+// of the means)
+template<typename T, Quantity Q1, Quantity Q2>
+[[nodiscard]] constexpr T sum_comoments(std::span<const Q1> xs, T mean_x, std::span<const Q2> ys, T mean_y)
+{
+  std::array<T, statistics_lanes> acc{};
+  std::size_t i = 0;
+  for (; i + statistics_lanes <= xs.size(); i += statistics_lanes)
+    for (std::size_t j = 0; j < statistics_lanes; ++j)
+      acc[j] += (static_cast<T>(xs[i + j].numerical_value()) - mean_x) *
+                (static_cast<T>(ys[i + j].numerical_value()) - mean_y);
+  for (; i < xs.size(); ++i)
+    acc[0] += (static_cast<T>(xs[i].numerical_value()) - mean_x) * (static_cast<T>(ys[i].numerical_value()) - mean_y);
+  T sum{};
+  for (const T& a : acc) sum += a;
+  return sum;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Streaming mean and variance of quantities
+ *
+ * Uses Welford's algorithm for single values, and a two-pass algorithm combined with the pairwise
+ * update of Chan et al. for bulk pushes and merges, so it is numerically stable and needs O(1) memory.
+ * Partial results computed independently (e.g. by different threads) can be combined with `merge()`.
+ *
+ * The results carry the correct references: for a `quantity<si::metre>` the mean is expressed in
+ * metres, the variance in square metres, and the standard deviation in metres again.
+ *
+ * @tparam Q a quantity type of the samples
+ */
+template<Quantity Q>
+class running_stats {
+  using calc_rep = detail::statistics_calc_rep<typename Q::rep>;
+
+public:
+  using value_type = quantity<Q::reference, calc_rep>;
+  using variance_type = decltype(std::declval<value_type>() * std::declval<value_type>());
+
+  constexpr running_stats() = default;
+
+  constexpr void push(const Q& x)
+  {
+    const value_type v = value_cast<calc_rep>(x);
+    if (count_ == 0) min_ = max_ = v;
+    else {
+      if (v < min_) min_ = v;
+      if (max_ < v) max_ = v;
+    }
+    ++count_;
+    const value_type delta = v - mean_;
+    mean_ += delta / static_cast<calc_rep>(count_);
+    m2_ += delta * (v - mean_);
+  }
+
+  /**
+   * @brief Pushes all the samples of a contiguous range
+   *
+   * The samples are reduced in a few independent lanes which can be processed with SIMD instructions.
+   */
+  constexpr void push(std::span<const Q> xs)
+  {
+    if (xs.empty()) return;
+    running_stats batch;
+    batch.count_ = xs.size();
+    const calc_rep mean = detail::sum_values<calc_rep>(xs) / static_cast<calc_rep>(xs.size());
+    batch.mean_ = make_quantity<Q::reference>(mean);
+    batch.m2_ = make_quantity<variance_type::reference>(detail::sum_comoments<calc_rep>(xs, mean, xs, mean));
+    calc_rep lo = static_cast<calc_rep>(xs[0].numerical_value());
+    calc_rep hi = lo;
+    for (const Q& x : xs) {
+      const auto v = static_cast<calc_rep>(x.numerical_value());
+      lo = v < lo ? v : lo;
+      hi = hi < v ? v : hi;
+    }
+    batch.min_ = make_quantity<Q::reference>(lo);
+    batch.max_ = make_quantity<Q::reference>(hi);
+    merge(batch);
+  }
+
+  /**
+   * @brief Combines the statistics with the ones computed for another set of samples
+   */
+  constexpr running_stats& merge(const running_stats& other)
+  {
+    if (other.count_ == 0) return *this;
+    if (count_ == 0) return *this = other;
+    const std::size_t n = count_ + other.count_;
+    const value_type delta = other.mean_ - mean_;
+    const calc_rep weight = static_cast<calc_rep>(other.count_) / static_cast<calc_rep>(n);
+    mean_ += delta * weight;
+    m2_ += other.m2_ + delta * delta * (static_cast<calc_rep>(count_) * weight);
+    if (other.min_ < min_) min_ = other.min_;
+    if (max_ < other.max_) max_ = other.max_;
+    count_ = n;
+    return *this;
+  }
+
+  [[nodiscard]] constexpr std::size_t count() const noexcept { return count_; }
+
+  [[nodiscard]] constexpr value_type mean() const
+  {
+    gsl_Expects(count_ > 0);
+    return mean_;
+  }
+
+  [[nodiscard]] constexpr value_type min() const
+  {
+    gsl_Expects(count_ > 0);
+    return min_;
+  }
+
+  [[nodiscard]] constexpr value_type max() const
+  {
+    gsl_Expects(count_ > 0);
+    return max_;
+  }
+
+  /**
+   * @brief The population variance
+   */
+  [[nodiscard]] constexpr variance_type variance() const
+  {
+    gsl_Expects(count_ > 0);
+    return m2_ / static_cast<calc_rep>(count_);
+  }
+
+  /**
+   * @brief The unbiased sample variance
+   */
+  [[nodiscard]] constexpr variance_type sample_variance() const
+  {
+    gsl_Expects(count_ > 1);
+    return m2_ / static_cast<calc_rep>(count_ - 1);
+  }
+
+  /**
+   * @brief The population standard deviation
+   */
+  [[nodiscard]] Quantity auto stddev() const { return sqrt(variance()); }
+
+  /**
+   * @brief The sample standard deviation
+   */
+  [[nodiscard]] Quantity auto sample_stddev() const { return sqrt(sample_variance()); }
+
+private:
+  std::size_t count_ = 0;
+  value_type mean_ = value_type::zero();
+  variance_type m2_ = variance_type::zero();
+  value_type min_ = value_type::zero();
+  value_type max_ = value_type::zero();
+};
+
+/**
+ * @brief Streaming covariance of pairs of quantities
+ *
+ * Uses the same algorithms as `running_stats`. The covariance has the type of the product of both
+ * quantities, e.g. for a length and a time it is a quantity of `length * time`.
+ *
+ * @tparam Q1 a quantity type of the first elements of the pairs
+ * @tparam Q2 a quantity type of the second elements of the pairs
+ */
+template<Quantity Q1, Quantity Q2>
+class running_covariance {
+  using calc_rep = detail::statistics_calc_rep<std::common_type_t<typename Q1::rep, typename Q2::rep>>;
+
+public:
+  using first_type = quantity<Q1::reference, calc_rep>;
+  using second_type = quantity<Q2::reference, calc_rep>;
+  using covariance_type = decltype(std::declval<first_type>() * std::declval<second_type>());
+
+  constexpr running_covariance() = default;
+
+  constexpr void push(const Q1& x, const Q2& y)
+  {
+    ++count_;
+    const calc_rep n = static_cast<calc_rep>(count_);
+    const first_type dx = value_cast<calc_rep>(x) - mean_x_;
+    mean_x_ += dx / n;
+    mean_y_ += (value_cast<calc_rep>(y) - mean_y_) / n;
+    c_ += dx * (value_cast<calc_rep>(y) - mean_y_);
+  }
+
+  /**
+   * @brief Pushes all the pairs of elements of two contiguous ranges of the same size
+   */
+  constexpr void push(std::span<const Q1> xs, std::span<const Q2> ys)
+  {
+    gsl_Expects(xs.size() == ys.size());
+    if (xs.empty()) return;
+    running_covariance batch;
+    batch.count_ = xs.size();
+    const calc_rep mean_x = detail::sum_values<calc_rep>(xs) / static_cast<calc_rep>(xs.size());
+    const calc_rep mean_y = detail::sum_values<calc_rep>(ys) / static_cast<calc_rep>(ys.size());
+    batch.mean_x_ = make_quantity<Q1::reference>(mean_x);
+    batch.mean_y_ = make_quantity<Q2::reference>(mean_y);
+    batch.c_ = make_quantity<covariance_type::reference>(detail::sum_comoments<calc_rep>(xs, mean_x, ys, mean_y));
+    merge(batch);
+  }
+
+  /**
+   * @brief Combines the covariance with the one computed for another set of pairs
+   */
+  constexpr running_covariance& merge(const running_covariance& other)
+  {
+    if (other.count_ == 0) return *this;
+    if (count_ == 0) return *this = other;
+    const std::size_t n = count_ + other.count_;
+    const first_type dx = other.mean_x_ - mean_x_;
+    const second_type dy = other.mean_y_ - mean_y_;
+    const calc_rep weight = static_cast<calc_rep>(other.count_) / static_cast<calc_rep>(n);
+    mean_x_ += dx * weight;
+    mean_y_ += dy * weight;
+    c_ += other.c_ + dx * dy * (static_cast<calc_rep>(count_) * weight);
+    count_ = n;
+    return *this;
+  }
+
+  [[nodiscard]] constexpr std::size_t count() const noexcept { return count_; }
+
+  [[nodiscard]] constexpr first_type mean_x() const
+  {
+    gsl_Expects(count_ > 0);
+    return mean_x_;
+  }
+
+  [[nodiscard]] constexpr second_type mean_y() const
+  {
+    gsl_Expects(count_ > 0);
+    return mean_y_;
+  }
+
+  /**
+   * @brief The population covariance
+   */
+  [[nodiscard]] constexpr covariance_type covariance() const
+  {
+    gsl_Expects(count_ > 0);
+    return c_ / static_cast<calc_rep>(count_);
+  }
+
+  /**
+   * @brief The unbiased sample covariance
+   */
+  [[nodiscard]] constexpr covariance_type sample_covariance() const
+  {
+    gsl_Expects(count_ > 1);
+    return c_ / static_cast<calc_rep>(count_ - 1);
+  }
+
+private:
+  std::size_t count_ = 0;
+  first_type mean_x_ = first_type::zero();
+  second_type mean_y_ = second_type::zero();
+  covariance_type c_ = covariance_type::zero();
+};
+
+}  // namespace mp_units
@@ -0,0 +1,501 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/linear_algebra.h>
+#include <mp-units/quantity.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/unit.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+namespace mp_units {
+
+/**
+ * @brief A fixed-size symmetric `N` x `N` matrix of values of an arithmetic type
+ *
+ * Satisfies `is_tensor`, so it can be used as a representation type of symmetric tensor
+ * quantities (e.g. `isq::stress`, `isq::strain`, or `isq::moment_of_inertia`). Only the
+ * `N (N + 1) / 2` independent values are stored (the diagonal first, then the upper triangle
+ * row by row) in a single `vec`, so the element-wise operations are whole SIMD instructions.
+ */
+template<std::size_t N, typename T>
+  requires(N > 0) && std::is_arithmetic_v<T> && (!std::same_as<T, bool>)
+class sym_mat {
+public:
+  using value_type = T;
+  using storage_type = vec<N*(N + 1) / 2, T>;
+  using row_type = vec<N, T>;
+
+  [[nodiscard]] static constexpr std::size_t rows() noexcept { return N; }
+  [[nodiscard]] static constexpr std::size_t cols() noexcept { return N; }
+
+  sym_mat() = default;
+
+  /**
+   * @brief Constructs a matrix from its rows, e.g. `sym_mat<2, double>{{1, 2}, {2, 3}}`
+   *
+   * @note The rows must form a symmetric matrix.
+   */
+  constexpr sym_mat(std::initializer_list<row_type> rows)
+  {
+    gsl_Expects(rows.size() == N);
+    const row_type* r = rows.begin();
+    for (std::size_t i = 0; i < N; ++i) {
+      data_[index(i, i)] = r[i][i];
+      for (std::size_t j = i + 1; j < N; ++j) {
+        gsl_Expects(r[i][j] == r[j][i]);
+        data_[index(i, j)] = r[i][j];
+      }
+    }
+  }
+
+  template<typename U>
+    requires(!std::same_as<U, T>) && std::convertible_to<U, T>
+  constexpr explicit(!detail::NonNarrowingConvertible<U, T>) sym_mat(const sym_mat<N, U>& other) :
+      data_(other.values())
+  {
+  }
+
+  /**
+   * @brief Constructs a matrix from its independent values (see `values()`)
+   */
+  [[nodiscard]] static constexpr sym_mat from_values(const storage_type& values)
+  {
+    sym_mat m;
+    m.data_ = values;
+    return m;
+  }
+
+  [[nodiscard]] static constexpr sym_mat diagonal(const vec<N, T>& d)
+  {
+    sym_mat m;
+    for (std::size_t i = 0; i < N; ++i) m.data_[i] = d[i];
+    return m;
+  }
+
+  [[nodiscard]] static constexpr sym_mat identity()
+  {
+    sym_mat m;
+    for (std::size_t i = 0; i < N; ++i) m.data_[i] = T{1};
+    return m;
+  }
+
+  [[nodiscard]] constexpr T& operator()(std::size_t i, std::size_t j) { return data_[index(i, j)]; }
+  [[nodiscard]] constexpr const T& operator()(std::size_t i, std::size_t j) const { return data_[index(i, j)]; }
+
+  /**
+   * @brief The position of the element in the `i`-th row and the `j`-th column in `values()`
+   */
+  [[nodiscard]] static constexpr std::size_t index(std::size_t i, std::size_t j)
+  {
+    if (i > j) std::swap(i, j);
+    if (i == j) return i;
+    // the diagonal followed by the rows of the strict upper triangle
+    return N + i * (2 * N - i - 1) / 2 + (j - i - 1);
+  }
+
+  /**
+   * @brief The independent values (the diagonal first, then the upper triangle row by row)
+   */
+  [[nodiscard]] constexpr const storage_type& values() const { return data_; }
+
+  [[nodiscard]] constexpr mat<N, N, T> full() const
+  {
+    mat<N, N, T> m;
+    for (std::size_t j = 0; j < N; ++j)
+      for (std::size_t i = 0; i < N; ++i) m(i, j) = (*this)(i, j);
+    return m;
+  }
+
+  [[nodiscard]] constexpr sym_mat operator+() const { return *this; }
+  [[nodiscard]] constexpr sym_mat operator-() const
+    requires std::is_signed_v<T>
+  {
+    return from_values(-data_);
+  }
+
+  constexpr sym_mat& operator+=(const sym_mat& other)
+  {
+    data_ += other.data_;
+    return *this;
+  }
+
+  constexpr sym_mat& operator-=(const sym_mat& other)
+  {
+    data_ -= other.data_;
+    return *this;
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  constexpr sym_mat& operator*=(const S& s)
+  {
+    data_ *= s;
+    return *this;
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  constexpr sym_mat& operator/=(const S& s)
+  {
+    data_ /= s;
+    return *this;
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator+(const sym_mat& lhs, const sym_mat<N, U>& rhs)
+  {
+    return make(lhs.data_ + rhs.values());
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator-(const sym_mat& lhs, const sym_mat<N, U>& rhs)
+  {
+    return make(lhs.data_ - rhs.values());
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  [[nodiscard]] friend constexpr auto operator*(const sym_mat& m, const S& s)
+  {
+    return make(m.data_ * s);
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  [[nodiscard]] friend constexpr auto operator*(const S& s, const sym_mat& m)
+  {
+    return make(m.data_ * s);
+  }
+
+  template<typename S>
+    requires std::is_arithmetic_v<S>
+  [[nodiscard]] friend constexpr auto operator/(const sym_mat& m, const S& s)
+  {
+    return make(m.data_ / s);
+  }
+
+  /**
+   * @brief The contraction of the tensor with a vector
+   */
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator*(const sym_mat& m, const vec<N, U>& v)
+  {
+    vec<N, decltype(T{} * U{})> r;
+    for (std::size_t i = 0; i < N; ++i) {
+      r[i] += m.data_[i] * v[i];
+      for (std::size_t j = i + 1; j < N; ++j) {
+        const T a = m.data_[index(i, j)];
+        r[i] += a * v[j];
+        r[j] += a * v[i];
+      }
+    }
+    return r;
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator*(const vec<N, U>& v, const sym_mat& m)
+  {
+    return m * v;
+  }
+
+  template<std::size_t C, typename U>
+  [[nodiscard]] friend constexpr auto operator*(const sym_mat& lhs, const mat<N, C, U>& rhs)
+  {
+    return lhs.full() * rhs;
+  }
+
+  template<std::size_t R, typename U>
+  [[nodiscard]] friend constexpr auto operator*(const mat<R, N, U>& lhs, const sym_mat& rhs)
+  {
+    return lhs * rhs.full();
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator*(const sym_mat& lhs, const sym_mat<N, U>& rhs)
+  {
+    return lhs.full() * rhs.full();
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr bool operator==(const sym_mat& lhs, const sym_mat<N, U>& rhs)
+  {
+    return lhs.data_ == rhs.values();
+  }
+
+private:
+  storage_type data_{};
+
+  template<typename U>
+  [[nodiscard]] static constexpr sym_mat<N, U> make(const vec<N*(N + 1) / 2, U>& values)
+  {
+    return sym_mat<N, U>::from_values(values);
+  }
+};
+
+template<std::size_t N, typename T>
+inline constexpr bool is_tensor<sym_mat<N, T>> = true;
+
+template<std::size_t N, typename T>
+[[nodiscard]] constexpr const sym_mat<N, T>& transpose(const sym_mat<N, T>& m)
+{
+  return m;
+}
+
+/**
+ * @brief The symmetric part `(m + transpose(m)) / 2` of a square matrix
+ */
+template<std::size_t N, typename T>
+[[nodiscard]] constexpr sym_mat<N, T> symmetric_part(const mat<N, N, T>& m)
+{
+  sym_mat<N, T> r;
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t j = i; j < N; ++j) r(i, j) = static_cast<T>((m(i, j) + m(j, i)) / 2);
+  return r;
+}
+
+/**
+ * @brief The tensor (outer) product of two vectors
+ */
+template<std::size_t R, std::size_t C, typename T, typename U>
+[[nodiscard]] constexpr auto outer(const vec<R, T>& lhs, const vec<C, U>& rhs)
+{
+  mat<R, C, decltype(T{} * U{})> m;
+  for (std::size_t j = 0; j < C; ++j)
+    for (std::size_t i = 0; i < R; ++i) m(i, j) = lhs[i] * rhs[j];
+  return m;
+}
+
+template<std::size_t N, typename T>
+[[nodiscard]] constexpr T trace(const mat<N, N, T>& m)
+{
+  T r{};
+  for (std::size_t i = 0; i < N; ++i) r += m(i, i);
+  return r;
+}
+
+template<std::size_t N, typename T>
+[[nodiscard]] constexpr T trace(const sym_mat<N, T>& m)
+{
+  T r{};
+  for (std::size_t i = 0; i < N; ++i) r += m(i, i);
+  return r;
+}
+
+/**
+ * @brief The double contraction `A : B` (the sum of the products of the corresponding elements)
+ */
+template<std::size_t R, std::size_t C, typename T, typename U>
+[[nodiscard]] constexpr auto double_dot(const mat<R, C, T>& lhs, const mat<R, C, U>& rhs)
+{
+  decltype(T{} * U{}) r{};
+  for (std::size_t j = 0; j < C; ++j) r += dot(lhs.col(j), rhs.col(j));
+  return r;
+}
+
+template<std::size_t N, typename T, typename U>
+[[nodiscard]] constexpr auto double_dot(const sym_mat<N, T>& lhs, const sym_mat<N, U>& rhs)
+{
+  // every off-diagonal value is stored once but appears twice in the matrix
+  decltype(T{} * U{}) diagonal{}, off_diagonal{};
+  const auto& a = lhs.values();
+  const auto& b = rhs.values();
+  for (std::size_t i = 0; i < N; ++i) diagonal += a[i] * b[i];
+  for (std::size_t i = N; i < a.size(); ++i) off_diagonal += a[i] * b[i];
+  return diagonal + 2 * off_diagonal;
+}
+
+template<typename M>
+  requires(M::rows() == M::cols()) && (M::rows() <= 3) &&
+          (std::same_as<M, mat<M::rows(), M::rows(), typename M::value_type>> ||
+           std::same_as<M, sym_mat<M::rows(), typename M::value_type>>)
+[[nodiscard]] constexpr typename M::value_type determinant(const M& m)
+{
+  if constexpr (M::rows() == 1)
+    return m(0, 0);
+  else if constexpr (M::rows() == 2)
+    return m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+  else
+    return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0)) +
+           m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+}
+
+/**
+ * @brief The eigenvalues and the eigenvectors of a symmetric tensor
+ *
+ * @tparam Value the type of the eigenvalues (a number or a scalar quantity)
+ */
+template<typename Value, std::size_t N, std::floating_point T>
+struct eigen_decomposition {
+  std::array<Value, N> values;  ///< in descending order
+  mat<N, N, T> vectors;         ///< the column `j` is the unit eigenvector of `values[j]`
+};
+
+/**
+ * @brief The eigen-decomposition of a symmetric matrix with the cyclic Jacobi method
+ *
+ * The method converges quadratically, and for 3 x 3 matrices needs only a few sweeps of three
+ * rotations each. It is accurate also for (almost) repeated eigenvalues, for which the closed
+ * form solutions of the characteristic polynomial lose precision. For `N == 3` the eigenvectors
+ * form a right-handed basis.
+ */
+template<std::size_t N, std::floating_point T>
+[[nodiscard]] eigen_decomposition<T, N, T> eigen(const sym_mat<N, T>& m)
+{
+  constexpr int max_sweeps = 50;
+  // plain arrays instead of `mat` as the rotations access single elements and not whole columns
+  std::array<std::array<T, N>, N> a;
+  std::array<std::array<T, N>, N> v{};
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t j = 0; j < N; ++j) a[i][j] = m(i, j);
+    v[i][i] = 1;
+  }
+  const T tolerance = std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon() * double_dot(m, m);
+
+  for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+    T off_diagonal{};
+    for (std::size_t p = 0; p < N; ++p)
+      for (std::size_t q = p + 1; q < N; ++q) off_diagonal += a[p][q] * a[p][q];
+    if (off_diagonal <= tolerance) break;
+
+    for (std::size_t p = 0; p < N; ++p) {
+      for (std::size_t q = p + 1; q < N; ++q) {
+        const T apq = a[p][q];
+        if (apq == T{}) continue;
+        // the rotation in the (p, q) plane that zeroes a[p][q]
+        const T theta = (a[q][q] - a[p][p]) / (2 * apq);
+        const T t = std::copysign(T{1}, theta) / (std::abs(theta) + std::sqrt(theta * theta + 1));
+        const T c = 1 / std::sqrt(t * t + 1);
+        const T s = t * c;
+        a[p][p] -= t * apq;
+        a[q][q] += t * apq;
+        a[p][q] = a[q][p] = T{};
+        for (std::size_t r = 0; r < N; ++r) {
+          if (r != p && r != q) {
+            const T arp = a[r][p], arq = a[r][q];
+            a[r][p] = a[p][r] = c * arp - s * arq;
+            a[r][q] = a[q][r] = s * arp + c * arq;
+          }
+          const T vrp = v[r][p], vrq = v[r][q];
+          v[r][p] = c * vrp - s * vrq;
+          v[r][q] = s * vrp + c * vrq;
+        }
+      }
+    }
+  }
+
+  std::array<std::size_t, N> order;
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::ranges::sort(order, [&](std::size_t i, std::size_t j) { return a[i][i] > a[j][j]; });
+
+  eigen_decomposition<T, N, T> r;
+  for (std::size_t j = 0; j < N; ++j) {
+    r.values[j] = a[order[j]][order[j]];
+    for (std::size_t i = 0; i < N; ++i) r.vectors(i, j) = v[i][order[j]];
+  }
+  if constexpr (N == 3) {
+    if (determinant(r.vectors) < 0)
+      for (std::size_t i = 0; i < N; ++i) r.vectors(i, 2) = -r.vectors(i, 2);
+  }
+  return r;
+}
+
+/**
+ * @brief A dimensionless vector quantity of the direction of `v` (e.g. the normal of a surface)
+ *
+ * Contracting a tensor quantity with it gives a vector quantity, e.g. the force acting on
+ * a surface is `stress * area * direction(normal)`.
+ */
+template<std::size_t N, std::floating_point T>
+[[nodiscard]] Quantity auto direction(const vec<N, T>& v)
+{
+  const T length = norm(v);
+  gsl_Expects(length > 0);
+  return (v / length) * (isq::position_vector / isq::length)[one];
+}
+
+/**
+ * @brief The trace of a tensor quantity
+ *
+ * The result is a scalar quantity of the same unit (e.g. the sum of the normal stresses).
+ */
+template<Quantity Q>
+  requires requires(const typename Q::rep& v) { trace(v); }
+[[nodiscard]] constexpr Quantity auto trace(const Q& q)
+{
+  return trace(q.numerical_value()) * Q::unit;
+}
+
+/**
+ * @brief The double contraction of two tensor quantities
+ *
+ * The result is a scalar quantity of the product of their units (e.g. `Pa` for a stress and
+ * a strain, which converts implicitly to an energy density).
+ */
+template<Quantity Q1, Quantity Q2>
+  requires requires(const typename Q1::rep& v1, const typename Q2::rep& v2) { double_dot(v1, v2); }
+[[nodiscard]] constexpr Quantity auto double_dot(const Q1& q1, const Q2& q2)
+{
+  return double_dot(q1.numerical_value(), q2.numerical_value()) * (Q1::unit * Q2::unit);
+}
+
+template<Quantity Q>
+  requires requires(const typename Q::rep& v) { transpose(v); }
+[[nodiscard]] constexpr Quantity auto transpose(const Q& q)
+{
+  return make_quantity<Q::reference>(transpose(q.numerical_value()));
+}
+
+/**
+ * @brief The principal values and the principal axes of a symmetric tensor quantity
+ *
+ * The principal values are scalar quantities of the unit of the tensor (e.g. the principal
+ * stresses or the principal moments of inertia).
+ */
+template<Quantity Q>
+  requires requires(const typename Q::rep& v) { eigen(v); }
+[[nodiscard]] auto eigen(const Q& q)
+{
+  using rep = typename Q::rep;
+  using value = quantity<Q::unit, typename rep::value_type>;
+  const auto e = eigen(q.numerical_value());
+  eigen_decomposition<value, rep::rows(), typename rep::value_type> r{{}, e.vectors};
+  for (std::size_t i = 0; i < rep::rows(); ++i) r.values[i] = e.values[i] * Q::unit;
+  return r;
+}
+
+}  // namespace mp_units
+
+template<std::size_t N, typename T, typename U>
+struct std::common_type<mp_units::sym_mat<N, T>, mp_units::sym_mat<N, U>> {
+  using type = mp_units::sym_mat<N, std::common_type_t<T, U>>;
+};
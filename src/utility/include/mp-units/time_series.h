@@ -0,0 +1,292 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/value_cast.h>
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_point.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mp_units {
+
+/**
+ * @brief The way values of a time series are obtained between its samples
+ */
+enum class interpolation {
+  step,   ///< the value of the last sample not later than the requested time
+  linear  ///< the value on a straight line between the neighbouring samples
+};
+
+/**
+ * @brief A time series of quantities
+ *
+ * Stores time points and values in two separate contiguous arrays (columnar storage) so that each
+ * of them can be processed as a whole with `times()` and `values()`. Samples have to be added in
+ * a strictly increasing order of time which makes it possible to find a sample for a given time
+ * with a binary search.
+ *
+ * Calculations involving interpolation are done with the representation type of the value or with
+ * `double` if it is an integral type. Derivatives and integrals have the quantity types resulting
+ * from the division and multiplication by time, e.g. a derivative of a speed series is an
+ * acceleration series.
+ *
+ * @tparam TimePoint a quantity point of time used to stamp the samples
+ * @tparam Value a quantity type of the values
+ */
+template<QuantityPointOf<isq::time> TimePoint, Quantity Value>
+class time_series {
+public:
+  using time_point = TimePoint;
+  using value_type = Value;
+  using duration = MP_UNITS_TYPENAME TimePoint::quantity_type;
+  using size_type = std::size_t;
+
+private:
+  using rep = MP_UNITS_TYPENAME Value::rep;
+  using calc_rep = std::conditional_t<treat_as_floating_point<rep>, rep, double>;
+  using calc_value = quantity<Value::reference, calc_rep>;
+  using calc_duration = quantity<duration::reference, calc_rep>;
+
+public:
+  using derivative_type = decltype(std::declval<calc_value>() / std::declval<calc_duration>());
+  using integral_type = decltype(std::declval<calc_value>() * std::declval<calc_duration>());
+
+  time_series() = default;
+
+  // data access
+  [[nodiscard]] bool empty() const noexcept { return times_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return times_.size(); }
+  [[nodiscard]] std::span<const time_point> times() const noexcept { return times_; }
+  [[nodiscard]] std::span<const value_type> values() const noexcept { return values_; }
+
+  [[nodiscard]] const time_point& time(size_type i) const
+  {
+    gsl_Expects(i < size());
+    return times_[i];
+  }
+
+  [[nodiscard]] const value_type& value(size_type i) const
+  {
+    gsl_Expects(i < size());
+    return values_[i];
+  }
+
+  // modifiers
+  void reserve(size_type n)
+  {
+    times_.reserve(n);
+    values_.reserve(n);
+  }
+
+  void clear() noexcept
+  {
+    times_.clear();
+    values_.clear();
+  }
+
+  void push_back(const time_point& t, const value_type& v)
+  {
+    gsl_Expects(empty() || times_.back() < t);
+    times_.push_back(t);
+    values_.push_back(v);
+  }
+
+  // lookup
+  /**
+   * @brief Returns the index of the first sample not earlier than `t` (or `size()` if there is none)
+   */
+  [[nodiscard]] size_type lower_bound(const time_point& t) const
+  {
+    return static_cast<size_type>(std::ranges::lower_bound(times_, t) - times_.begin());
+  }
+
+  /**
+   * @brief Returns the index of the first sample later than `t` (or `size()` if there is none)
+   */
+  [[nodiscard]] size_type upper_bound(const time_point& t) const
+  {
+    return static_cast<size_type>(std::ranges::upper_bound(times_, t) - times_.begin());
+  }
+
+  /**
+   * @brief Returns the value of the series at any time between the first and the last sample
+   */
+  [[nodiscard]] value_type value_at(const time_point& t, interpolation mode = interpolation::linear) const
+  {
+    gsl_Expects(!empty() && times_.front() <= t && t <= times_.back());
+    const size_type i = upper_bound(t) - 1;
+    if (mode == interpolation::step || i + 1 == size()) return values_[i];
+    return interpolate(i, t);
+  }
+
+  /**
+   * @brief Returns the series sampled with a fixed period starting from the first sample
+   *
+   * The whole series is processed in a single pass writing to preallocated storage, with a separate loop
+   * for each interpolation mode.
+   */
+  [[nodiscard]] time_series resample(const duration& period, interpolation mode = interpolation::linear) const
+  {
+    gsl_Expects(!empty() && period > duration::zero());
+    const auto count = static_cast<size_type>(((times_.back() - times_.front()) / period).numerical_value_in(one)) + 1;
+    time_series res;
+    res.times_.resize(count);
+    res.values_.resize(count);
+    const time_point first = times_.front();
+    const size_type last = size() - 1;
+    size_type i = 0;
+    if (mode == interpolation::step) {
+      for (size_type k = 0; k < count; ++k) {
+        const time_point t = first + static_cast<MP_UNITS_TYPENAME duration::rep>(k) * period;
+        while (i < last && times_[i + 1] <= t) ++i;
+        res.times_[k] = t;
+        res.values_[k] = values_[i];
+      }
+    } else {
+      for (size_type k = 0; k < count; ++k) {
+        const time_point t = first + static_cast<MP_UNITS_TYPENAME duration::rep>(k) * period;
+        while (i < last && times_[i + 1] <= t) ++i;
+        res.times_[k] = t;
+        res.values_[k] = i == last ? values_[i] : interpolate(i, t);
+      }
+    }
+    return res;
+  }
+
+  // windowed aggregates
+  /**
+   * @brief The smallest value of the samples in the `[from, to]` window
+   */
+  [[nodiscard]] value_type min(const time_point& from, const time_point& to) const
+  {
+    const auto w = window(from, to);
+    gsl_Expects(!w.empty());
+    return *std::ranges::min_element(w);
+  }
+
+  /**
+   * @brief The largest value of the samples in the `[from, to]` window
+   */
+  [[nodiscard]] value_type max(const time_point& from, const time_point& to) const
+  {
+    const auto w = window(from, to);
+    gsl_Expects(!w.empty());
+    return *std::ranges::max_element(w);
+  }
+
+  /**
+   * @brief The integral of the linearly interpolated series over the `[from, to]` window
+   */
+  [[nodiscard]] integral_type integral(const time_point& from, const time_point& to) const
+  {
+    gsl_Expects(!empty() && times_.front() <= from && from <= to && to <= times_.back());
+    time_point prev_t = from;
+    calc_value prev_v = value_cast<calc_rep>(value_at(from));
+    integral_type sum = integral_type::zero();
+    for (size_type i = upper_bound(from); i < size() && times_[i] < to; ++i) {
+      const calc_value v = value_cast<calc_rep>(values_[i]);
+      sum += (prev_v + v) * elapsed(prev_t, times_[i]) / calc_rep{2};
+      prev_t = times_[i];
+      prev_v = v;
+    }
+    sum += (prev_v + value_cast<calc_rep>(value_at(to))) * elapsed(prev_t, to) / calc_rep{2};
+    return sum;
+  }
+
+  /**
+   * @brief The time-weighted mean of the linearly interpolated series over the `[from, to]` window
+   */
+  [[nodiscard]] calc_value mean(const time_point& from, const time_point& to) const
+  {
+    gsl_Expects(from < to);
+    return value_cast<Value::unit>(integral(from, to) / elapsed(from, to));
+  }
+
+  // whole series transformations
+  /**
+   * @brief The derivative of the series estimated with central differences (one-sided at the ends)
+   */
+  [[nodiscard]] time_series<TimePoint, derivative_type> derivative() const
+  {
+    gsl_Expects(size() >= 2);
+    time_series<TimePoint, derivative_type> res;
+    res.reserve(size());
+    for (size_type i = 0; i < size(); ++i) {
+      const size_type prev = i == 0 ? 0 : i - 1;
+      const size_type next = i + 1 == size() ? i : i + 1;
+      res.push_back(times_[i], (value_cast<calc_rep>(values_[next]) - value_cast<calc_rep>(values_[prev])) /
+                                 elapsed(times_[prev], times_[next]));
+    }
+    return res;
+  }
+
+  /**
+   * @brief The running integral of the linearly interpolated series starting from zero at the first sample
+   */
+  [[nodiscard]] time_series<TimePoint, integral_type> integral() const
+  {
+    time_series<TimePoint, integral_type> res;
+    res.reserve(size());
+    integral_type sum = integral_type::zero();
+    for (size_type i = 0; i < size(); ++i) {
+      if (i > 0)
+        sum += (value_cast<calc_rep>(values_[i - 1]) + value_cast<calc_rep>(values_[i])) *
+               elapsed(times_[i - 1], times_[i]) / calc_rep{2};
+      res.push_back(times_[i], sum);
+    }
+    return res;
+  }
+
+private:
+  std::vector<time_point> times_;
+  std::vector<value_type> values_;
+
+  [[nodiscard]] std::span<const value_type> window(const time_point& from, const time_point& to) const
+  {
+    const size_type first = lower_bound(from);
+    const size_type last = upper_bound(to);
+    return std::span<const value_type>(values_).subspan(first, last > first ? last - first : 0);
+  }
+
+  [[nodiscard]] static calc_duration elapsed(const time_point& from, const time_point& to)
+  {
+    return value_cast<calc_rep>(duration(to - from));
+  }
+
+  [[nodiscard]] value_type interpolate(size_type i, const time_point& t) const
+  {
+    const calc_rep f = (elapsed(times_[i], t) / elapsed(times_[i], times_[i + 1])).numerical_value_in(one);
+    const calc_value v0 = value_cast<calc_rep>(values_[i]);
+    const calc_value v1 = value_cast<calc_rep>(values_[i + 1]);
+    return value_cast<rep>(v0 + (v1 - v0) * f);
+  }
+};
+
+}  // namespace mp_units
@@ -0,0 +1,108 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// SOFTWARE.
+
+// Compares sampling the binary-search based `discrete_distribution` and `piecewise_constant_distribution`
+// with their alias-table counterparts from _mp-units/random.h_ for a growing number of bins.
+
+#include "benchmark.h"
+#include <mp-units/random.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace mp_units;
+
+using length = quantity<isq::length[si::metre]>;
+using index = quantity<isq::length[si::metre], std::int64_t>;
+
+constexpr std::size_t samples_count = 2'000'000;
+constexpr int repetitions = 3;
+
+// returns the best time in nanoseconds per sample
+const benchmark::best_time measure(repetitions, static_cast<double>(samples_count));
+
+template<typename Q>
+double mean(const std::vector<Q>& samples)
+{
+  double sum = 0;
+  for (const auto& x : samples) sum += static_cast<double>(x.numerical_value_in(si::metre));
+  return sum / static_cast<double>(samples.size());
+}
+
+// returns `false` if the means of the samples of both distributions differ
+template<typename Dist, typename AliasDist, typename Q>
+bool compare(std::size_t bins, Dist dist, AliasDist alias_dist, std::vector<Q>& samples, double tolerance)
+{
+  std::mt19937_64 gen(42);
+  const double search = measure([&] { std::ranges::generate(samples, [&] { return dist(gen); }); });
+  const double search_mean = mean(samples);
+  const double alias = measure([&] { std::ranges::generate(samples, [&] { return alias_dist(gen); }); });
+  const double alias_bulk = measure([&] { alias_dist.generate(gen, samples); });
+  const double alias_mean = mean(samples);
+
+  std::cout << "  " << bins << " bins: binary search " << search << " ns/sample, alias " << alias
+            << " ns/sample, alias generate() " << alias_bulk << " ns/sample (" << search / alias_bulk << "x)\n";
+  return std::abs(search_mean - alias_mean) < tolerance;
+}
+
+}  // namespace
+
+int main()
+{
+  using namespace mp_units::si::unit_symbols;
+
+  std::vector<index> indices(samples_count);
+  std::vector<length> lengths(samples_count);
+  bool ok = true;
+
+  for (std::size_t bins : std::vector<std::size_t>{10, 100, 1'000, 10'000, 100'000}) {
+    // skewed weights so that the alias table has to redistribute most of the mass
+    std::vector<double> weights(bins);
+    for (std::size_t i = 0; i < bins; ++i) weights[i] = 1. + static_cast<double>(i % 7) * static_cast<double>(i % 7);
+    std::vector<length> boundaries(bins + 1);
+    for (std::size_t i = 0; i <= bins; ++i) boundaries[i] = static_cast<double>(i) * m;
+
+    std::cout << "discrete_distribution vs alias_discrete_distribution:\n";
+    ok = compare(bins, discrete_distribution<index>(weights.begin(), weights.end()),
+                 alias_discrete_distribution<index>(weights.begin(), weights.end()), indices,
+                 0.01 * static_cast<double>(bins)) &&
+         ok;
+    std::cout << "piecewise_constant_distribution vs alias_piecewise_constant_distribution:\n";
+    ok = compare(
+           bins, piecewise_constant_distribution<length>(boundaries.begin(), boundaries.end(), weights.begin()),
+           alias_piecewise_constant_distribution<length>(boundaries.begin(), boundaries.end(), weights.begin()),
+           lengths, 0.01 * static_cast<double>(bins)) &&
+         ok;
+  }
+
+  if (!ok) {
+    std::cerr << "The binary search and alias table samples have different means\n";
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,59 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <ratio>
+
+namespace mp_units::benchmark {
+
+// runs the measured code `repetitions` times and returns the best time in `Period` units per operation
+template<typename Period = std::nano>
+class best_time {
+public:
+  constexpr explicit best_time(int repetitions, double operations = 1.) :
+      repetitions_(repetitions), operations_(operations)
+  {
+  }
+
+  template<std::invocable Func>
+  double operator()(Func&& func) const
+  {
+    double best = 0.;
+    for (int i = 0; i < repetitions_; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      func();
+      const std::chrono::duration<double, Period> time = std::chrono::steady_clock::now() - start;
+      best = i == 0 ? time.count() : std::min(best, time.count());
+    }
+    return best / operations_;
+  }
+
+private:
+  int repetitions_;
+  double operations_;
+};
+
+}  // namespace mp_units::benchmark
@@ -0,0 +1,109 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares the cost of reading a clock through `quantity_clock` with the cost of reading the underlying
+// `std::chrono` clock (and the raw time stamp counter where available).
+//
+// In optimized builds the unit-typed reading should cost the same as the raw one.
+
+#include "benchmark.h"
+#include <mp-units/chrono.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+using namespace mp_units;
+
+constexpr int reads = 1'000'000;
+constexpr int repetitions = 5;
+
+// accumulates the readings so that the compiler can't remove them
+volatile std::int64_t sink;
+
+// returns the best time in nanoseconds per read
+template<typename Func>
+double measure(Func func)
+{
+  return benchmark::best_time(repetitions, reads)([&] {
+    std::int64_t sum = 0;
+    for (int j = 0; j < reads; ++j) sum += func();
+    sink = sum;
+  });
+}
+
+template<typename C>
+std::int64_t raw_read()
+{
+  return C::now().time_since_epoch().count();
+}
+
+template<typename C>
+std::int64_t quantity_read()
+{
+  using clock = quantity_clock<C>;
+  return (clock::now() - chrono_point_origin<C>).numerical_value_in(clock::unit);
+}
+
+void report(const char* name, double raw, double quantity)
+{
+  std::cout << name << ":\n";
+  std::cout << "  raw:      " << raw << " ns\n";
+  std::cout << "  quantity: " << quantity << " ns\n";
+  std::cout << "  overhead: " << quantity / raw << "x\n";
+}
+
+template<typename C>
+bool is_monotonic()
+{
+  using clock = quantity_clock<C>;
+  auto prev = clock::now();
+  for (int i = 0; i < reads; ++i) {
+    const auto now = clock::now();
+    if (now < prev) return false;
+    prev = now;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main()
+{
+  report("steady_clock", measure(raw_read<std::chrono::steady_clock>),
+         measure(quantity_read<std::chrono::steady_clock>));
+  bool ok = is_monotonic<std::chrono::steady_clock>();
+
+#if MP_UNITS_HAS_TSC_CLOCK
+  std::cout << "tsc_clock (" << tsc_clock::frequency().numerical_value_in(si::giga<si::hertz>) << " GHz):\n";
+  std::cout << "  rdtsc:    " << measure([] { return static_cast<std::int64_t>(tsc_clock::ticks()); }) << " ns\n";
+  report("tsc_clock", measure(raw_read<tsc_clock>), measure(quantity_read<tsc_clock>));
+  ok = ok && is_monotonic<tsc_clock>();
+#endif
+
+  if (!ok) {
+    std::cerr << "Clock readings are not monotonic\n";
+    return EXIT_FAILURE;
+  }
+}
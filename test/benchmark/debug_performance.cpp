@@ -0,0 +1,102 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Compares a simple motion simulation written with raw `double` values with the same code using quantities.
+//
+// In optimized builds both versions should run at the same speed. In unoptimized builds quantity operations
+// are function calls unless `MP_UNITS_FORCE_INLINE` is enabled.
+
+#include "benchmark.h"
+#include <mp-units/systems/si/units.h>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <ratio>
+
+namespace {
+
+using namespace mp_units;
+
+constexpr int steps = 2'000'000;
+constexpr int repetitions = 3;
+
+// volatile so that the compiler can't precompute the results
+volatile double time_step = 0.001;
+volatile double acceleration = 9.81;
+volatile double track_length = 2.5;
+
+double simulate_raw()
+{
+  const double dt = time_step;        // [s]
+  const double a = acceleration;      // [m/s²]
+  const double limit = track_length;  // [km]
+  const double v_max = 100.;          // [m/s]
+  double v = 0.;                      // [m/s]
+  double x = 0.;                      // [m]
+  for (int i = 0; i < steps; ++i) {
+    v += a * dt;
+    x += v * dt;
+    if (x > limit * 1000.) x -= limit * 1000.;
+    if (v > v_max) v = -v;
+  }
+  return x;
+}
+
+double simulate_quantity()
+{
+  const quantity<si::second> dt = time_step * si::second;
+  const quantity<si::metre / square(si::second)> a = acceleration * (si::metre / square(si::second));
+  const quantity<si::kilo<si::metre>> limit = track_length * si::kilo<si::metre>;
+  const quantity<si::metre / si::second> v_max = 100. * (si::metre / si::second);
+  quantity<si::metre / si::second> v = 0. * (si::metre / si::second);
+  quantity<si::metre> x = 0. * si::metre;
+  for (int i = 0; i < steps; ++i) {
+    v += a * dt;
+    x += v * dt;
+    if (x > limit) x -= limit;
+    if (v > v_max) v = -v;
+  }
+  return x.numerical_value_in(si::metre);
+}
+
+const benchmark::best_time<std::milli> measure(repetitions);
+
+}  // namespace
+
+int main()
+{
+  double raw_result{};
+  double quantity_result{};
+  const double raw_time = measure([&] { raw_result = simulate_raw(); });
+  const double quantity_time = measure([&] { quantity_result = simulate_quantity(); });
+
+  std::cout << "MP_UNITS_FORCE_INLINE: " << MP_UNITS_FORCE_INLINE << "\n";
+  std::cout << "raw:      " << raw_time << " ms\n";
+  std::cout << "quantity: " << quantity_time << " ms\n";
+  std::cout << "overhead: " << quantity_time / raw_time << "x\n";
+
+  if (std::abs(quantity_result - raw_result) > 1e-9 * std::abs(raw_result)) {
+    std::cerr << "Results differ: " << raw_result << " != " << quantity_result << "\n";
+    return EXIT_FAILURE;
+  }
+}
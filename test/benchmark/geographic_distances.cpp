@@ -0,0 +1,113 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// SOFTWARE.
+
+
+// Compares computing great-circle distances between pairs of positions stored as structures of
+// degree quantities (converted to radians on every call) with the batched haversine kernel over
+// `geographic_positions`, and measures the batched Vincenty kernel.
+
+#include "benchmark.h"
+#include <mp-units/geographic.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+constexpr std::size_t count = 1 << 20;
+constexpr int repetitions = 5;
+
+// returns the best time in nanoseconds per pair of positions
+const benchmark::best_time measure(repetitions, static_cast<double>(count));
+
+struct degree_position {
+  quantity<isq::angular_measure[deg]> lat;
+  quantity<isq::angular_measure[deg]> lon;
+};
+
+// the scalar formula on degree quantities
+geographic_distance<> per_call_distance(const degree_position& from, const degree_position& to)
+{
+  const auto sin_lat = isq::sin((to.lat - from.lat) / 2);
+  const auto sin_lon = isq::sin((to.lon - from.lon) / 2);
+  const auto central_angle =
+    2 * isq::asin(sqrt(sin_lat * sin_lat + isq::cos(from.lat) * isq::cos(to.lat) * sin_lon * sin_lon));
+  return earth_mean_radius.numerical_value_in(m) * central_angle.numerical_value_in(rad) * isq::distance[m];
+}
+
+degree_position input(std::size_t i, std::size_t k)
+{
+  const auto v = [&](std::size_t m) { return static_cast<double>((i * 7919 + k * 104729 + m * 31) % 100'000) / 1e5; };
+  return {(v(0) * 170. - 85.) * isq::angular_measure[deg], (v(1) * 360. - 180.) * isq::angular_measure[deg]};
+}
+
+}  // namespace
+
+int main()
+{
+  std::vector<degree_position> from_aos(count), to_aos(count);
+  geographic_positions<> from, to;
+  from.reserve(count);
+  to.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    from_aos[i] = input(i, 0);
+    to_aos[i] = input(i, 1);
+    from.push_back({from_aos[i].lat, from_aos[i].lon});
+    to.push_back({to_aos[i].lat, to_aos[i].lon});
+  }
+
+  std::vector<geographic_distance<>> per_call(count);
+  const double per_call_time =
+    measure([&] { std::ranges::transform(from_aos, to_aos, per_call.begin(), per_call_distance); });
+
+  std::vector<geographic_distance<>> haversine(count);
+  const double haversine_time = measure([&] { haversine_distance(from, to, haversine); });
+
+  std::vector<geographic_distance<>> one_to_many(count);
+  const double one_to_many_time = measure([&] { haversine_distance(from[0], to, one_to_many); });
+
+  std::vector<geographic_distance<>> vincenty(count);
+  std::vector<geographic_bearing<>> bearings(count);
+  const double vincenty_time = measure([&] { vincenty_inverse(from, to, vincenty, bearings); });
+
+  std::cout << "per call on degrees: " << per_call_time << " ns, batched haversine: " << haversine_time
+            << " ns, one-to-many haversine: " << one_to_many_time << " ns, batched Vincenty: " << vincenty_time
+            << " ns\n";
+
+  for (std::size_t i = 0; i < count; i += 4099) {
+    const bool haversine_ok = abs(per_call[i] - haversine[i]) <= 1e-6 * isq::distance[m];
+    // the spherical model differs from the ellipsoid by less than 0.6% (Vincenty is NaN if not converged)
+    const bool vincenty_ok = std::isnan(vincenty[i].numerical_value_in(m)) ||
+                             abs(vincenty[i] - haversine[i]) <= 0.006 * haversine[i] + 1. * isq::distance[m];
+    if (!haversine_ok || !vincenty_ok) {
+      std::cerr << "The kernels computed different results\n";
+      return EXIT_FAILURE;
+    }
+  }
+}
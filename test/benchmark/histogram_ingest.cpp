@@ -0,0 +1,124 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Measures how many samples per second `histogram` and `quantile_sketch` ingest on a single core and
+// when every thread records into its own shard that is merged into a shared aggregate at the end.
+//
+// In optimized builds recording should reach tens of millions of samples per second per core.
+
+#include "benchmark.h"
+#include <mp-units/histogram.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <ratio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace mp_units;
+
+using latency = quantity<isq::time[si::micro<si::second>]>;
+
+constexpr std::size_t samples_count = 10'000'000;
+constexpr int repetitions = 3;
+
+std::vector<latency> make_samples()
+{
+  // log-normal latencies with the median of 100 us
+  std::mt19937_64 gen(42);
+  std::lognormal_distribution<double> dist(std::log(100.), 1.);
+  std::vector<latency> samples;
+  samples.reserve(samples_count);
+  for (std::size_t i = 0; i < samples_count; ++i) samples.push_back(dist(gen) * isq::time[si::micro<si::second>]);
+  return samples;
+}
+
+// returns the ingest rate in millions of samples per second
+template<typename H>
+double measure(const H& prototype, const std::vector<latency>& samples)
+{
+  // every run records into its own empty histogram
+  std::vector<H> runs;
+  for (int i = 0; i < repetitions; ++i) runs.push_back(prototype.empty_copy());
+  std::size_t run = 0;
+  const double time = benchmark::best_time<std::ratio<1>>(repetitions)([&] { runs[run++].record(samples); });
+  return static_cast<double>(samples.size()) / time / 1e6;
+}
+
+// every thread records all the samples into its own shard and merges it into the aggregate
+template<typename H>
+double measure_sharded(H& aggregate, const std::vector<latency>& samples, unsigned threads)
+{
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < threads; ++t)
+    workers.emplace_back([&] {
+      auto shard = aggregate.empty_copy();
+      shard.record(samples);
+      aggregate.merge(shard);
+    });
+  for (auto& w : workers) w.join();
+  const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(samples.size()) * threads / time.count() / 1e6;
+}
+
+}  // namespace
+
+int main()
+{
+  using namespace mp_units::si::unit_symbols;
+
+  const auto samples = make_samples();
+  const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+  const histogram<latency> linear(linear_bins<latency>(0. * us, 10. * ms, 1000));
+  const histogram<latency, log_bins<latency>> logarithmic(log_bins<latency>(1. * us, 10. * s, 700));
+  quantile_sketch<latency> sketch(1. * ns, 1. * h, 0.01);
+
+  std::cout << "single core [Msamples/s]:\n";
+  std::cout << "  linear histogram: " << measure(linear, samples) << "\n";
+  std::cout << "  log histogram:    " << measure(logarithmic, samples) << "\n";
+  std::cout << "  quantile sketch:  " << measure(sketch, samples) << "\n";
+
+  std::cout << threads << " sharded threads [Msamples/s]:\n";
+  std::cout << "  quantile sketch:  " << measure_sharded(sketch, samples, threads) << "\n";
+
+  if (sketch.count() != samples.size() * threads) {
+    std::cerr << "Samples lost while merging the shards\n";
+    return EXIT_FAILURE;
+  }
+  const auto median = sketch.quantile(0.5);
+  std::cout << "median: " << median.numerical_value_in(us) << " us\n";
+  if (abs(median - 100. * us) > 0.05 * (100. * us)) {
+    std::cerr << "The median estimate is out of range\n";
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,100 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares tracking many targets with separate `kalman_filter` objects with the same filters stored and
+// updated as a batch of `kalman_filters` (a position, a velocity, and an acceleration per target).
+
+#include "benchmark.h"
+#include <mp-units/kalman_filter.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <cstdlib>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+using position = quantity<isq::height[m]>;
+using velocity = quantity<isq::speed[m / s]>;
+using acceleration = quantity<isq::speed[m / s] / isq::time[s]>;
+using filter = kalman_filter<position, velocity, acceleration>;
+using covariance = filter::covariance_type;
+
+constexpr std::size_t count = 4096;
+constexpr int steps = 100;
+constexpr int repetitions = 5;
+
+// returns the best time in nanoseconds per filter and step
+const benchmark::best_time measure(repetitions, static_cast<double>(count * steps));
+
+}  // namespace
+
+int main()
+{
+  const auto interval = 0.1 * s;
+  const auto process_noise = covariance::piecewise_white_noise(interval, 0.01 * (m2 / pow<6>(s)));
+  const auto measurement_variance = 4. * m2;
+
+  std::vector<filter> separate;
+  kalman_filters<position, velocity, acceleration> batch;
+  batch.reserve(count);
+  std::vector<position> measured(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto v = static_cast<double>(i % 100);
+    separate.emplace_back(std::tuple{v * isq::height[m], velocity{}, acceleration{}},
+                          covariance::diagonal(100. * m2, 10. * (m2 / s2), 1. * (m2 / pow<4>(s))));
+    batch.push_back(separate.back());
+    measured[i] = (v + 0.5) * isq::height[m];
+  }
+
+  const double separate_time = measure([&] {
+    for (int step = 0; step < steps; ++step)
+      for (std::size_t i = 0; i < count; ++i) {
+        separate[i].predict(interval, process_noise);
+        separate[i].update(measured[i], measurement_variance);
+      }
+  });
+
+  const double batch_time = measure([&] {
+    for (int step = 0; step < steps; ++step) {
+      batch.predict(interval, process_noise);
+      batch.update(measured, measurement_variance);
+    }
+  });
+
+  std::cout << "separate filters: " << separate_time << " ns, batch of " << batch.lanes
+            << "-filter blocks: " << batch_time << " ns per filter and step\n";
+
+  for (std::size_t i = 0; i < count; i += 97) {
+    const filter f = batch[i];
+    if (abs(f.get<0>() - separate[i].get<0>()) > 1e-9 * isq::height[m] ||
+        abs(f.get<1>() - separate[i].get<1>()) > 1e-9 * isq::speed[m / s]) {
+      std::cerr << "The filters computed different results\n";
+      return EXIT_FAILURE;
+    }
+  }
+}
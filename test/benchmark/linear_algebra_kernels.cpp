@@ -0,0 +1,196 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// SOFTWARE.
+
+// Compares the dot product, cross product, norm, and matrix-vector product kernels over arrays of
+// vector quantities represented with `vec` from _mp-units/linear_algebra.h_ with the same kernels
+// over plain `std::array` values and (if available) over the wg21 linear algebra library.
+
+#include "benchmark.h"
+#include <mp-units/linear_algebra.h>
+#include <mp-units/systems/isq/mechanics.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#ifdef MP_UNITS_BENCHMARK_WG21_LA
+#include <matrix>
+#endif
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+constexpr std::size_t count = 1 << 20;
+constexpr int repetitions = 5;
+
+// returns the best time in nanoseconds per vector
+const benchmark::best_time measure(repetitions, static_cast<double>(count));
+
+struct results {
+  double dot = 0, cross = 0, norm = 0, transform = 0;
+  double checksum = 0;
+};
+
+void print(const char* name, const results& r)
+{
+  std::cout << name << ": dot " << r.dot << " ns, cross " << r.cross << " ns, norm " << r.norm << " ns, mat * vec "
+            << r.transform << " ns\n";
+}
+
+const std::array<std::array<double, 3>, 3> rotation = {
+  {{0.36, 0.48, -0.8}, {-0.8, 0.6, 0.}, {0.48, 0.64, 0.6}}};
+
+double input(std::size_t i, std::size_t k) { return static_cast<double>((i * 7 + k * 3) % 11) - 5.; }
+
+results run_vec()
+{
+  using force = quantity<isq::force[N], vec<3, double>>;
+  using position = quantity<isq::position_vector[m], vec<3, double>>;
+  std::vector<force> f(count);
+  std::vector<position> d(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    f[i] = vec{input(i, 0), input(i, 1), input(i, 2)} * isq::force[N];
+    d[i] = vec{input(i, 2), input(i, 0), input(i, 1)} * isq::position_vector[m];
+  }
+  const mat<3, 3, double> rot = {{rotation[0][0], rotation[0][1], rotation[0][2]},
+                                 {rotation[1][0], rotation[1][1], rotation[1][2]},
+                                 {rotation[2][0], rotation[2][1], rotation[2][2]}};
+
+  results r;
+  std::vector<quantity<isq::mechanical_work[J]>> work(count);
+  r.dot = measure([&] { std::ranges::transform(f, d, work.begin(), [](auto a, auto b) { return dot(a, b); }); });
+  std::vector<quantity<isq::moment_of_force[N * m], vec<3, double>>> moments(count);
+  r.cross =
+    measure([&] { std::ranges::transform(d, f, moments.begin(), [](auto a, auto b) { return cross(a, b); }); });
+  std::vector<quantity<N>> magnitudes(count);
+  r.norm = measure([&] { std::ranges::transform(f, magnitudes.begin(), [](auto a) { return norm(a); }); });
+  std::vector<force> rotated(count);
+  r.transform = measure([&] { std::ranges::transform(f, rotated.begin(), [&](auto a) { return rot * a; }); });
+  for (std::size_t i = 0; i < count; i += 4099)
+    r.checksum += work[i].numerical_value_in(J) + moments[i].numerical_value_in(N * m)[2] +
+                  magnitudes[i].numerical_value_in(N) + rotated[i].numerical_value_in(N)[1];
+  return r;
+}
+
+results run_array()
+{
+  using v3 = std::array<double, 3>;
+  std::vector<v3> f(count), d(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    f[i] = {input(i, 0), input(i, 1), input(i, 2)};
+    d[i] = {input(i, 2), input(i, 0), input(i, 1)};
+  }
+
+  results r;
+  std::vector<double> work(count);
+  r.dot = measure([&] {
+    std::ranges::transform(f, d, work.begin(), [](const v3& a, const v3& b) {
+      return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    });
+  });
+  std::vector<v3> moments(count);
+  r.cross = measure([&] {
+    std::ranges::transform(d, f, moments.begin(), [](const v3& a, const v3& b) {
+      return v3{a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    });
+  });
+  std::vector<double> magnitudes(count);
+  r.norm = measure([&] {
+    std::ranges::transform(f, magnitudes.begin(),
+                           [](const v3& a) { return std::sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]); });
+  });
+  std::vector<v3> rotated(count);
+  r.transform = measure([&] {
+    std::ranges::transform(f, rotated.begin(), [&](const v3& a) {
+      v3 res{};
+      for (std::size_t i = 0; i < 3; ++i)
+        for (std::size_t j = 0; j < 3; ++j) res[i] += rotation[i][j] * a[j];
+      return res;
+    });
+  });
+  for (std::size_t i = 0; i < count; i += 4099)
+    r.checksum += work[i] + moments[i][2] + magnitudes[i] + rotated[i][1];
+  return r;
+}
+
+#ifdef MP_UNITS_BENCHMARK_WG21_LA
+results run_wg21()
+{
+  using v3 = STD_LA::fixed_size_column_vector<double, 3>;
+  using m3 = STD_LA::fixed_size_matrix<double, 3, 3>;
+  std::vector<v3> f(count), d(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    f[i] = v3{input(i, 0), input(i, 1), input(i, 2)};
+    d[i] = v3{input(i, 2), input(i, 0), input(i, 1)};
+  }
+  m3 rot;
+  for (std::size_t i = 0; i < 3; ++i)
+    for (std::size_t j = 0; j < 3; ++j) rot(i, j) = rotation[i][j];
+
+  results r;
+  std::vector<double> work(count);
+  r.dot = measure([&] {
+    std::ranges::transform(f, d, work.begin(), [](const v3& a, const v3& b) { return STD_LA::inner_product(a, b); });
+  });
+  std::vector<v3> moments(count);
+  r.cross = measure([&] {
+    std::ranges::transform(d, f, moments.begin(), [](const v3& a, const v3& b) {
+      return v3{a(1) * b(2) - a(2) * b(1), a(2) * b(0) - a(0) * b(2), a(0) * b(1) - a(1) * b(0)};
+    });
+  });
+  std::vector<double> magnitudes(count);
+  r.norm = measure([&] {
+    std::ranges::transform(f, magnitudes.begin(), [](const v3& a) { return std::sqrt(STD_LA::inner_product(a, a)); });
+  });
+  std::vector<v3> rotated(count);
+  r.transform = measure([&] { std::ranges::transform(f, rotated.begin(), [&](const v3& a) { return rot * a; }); });
+  for (std::size_t i = 0; i < count; i += 4099)
+    r.checksum += work[i] + moments[i](2) + magnitudes[i] + rotated[i](1);
+  return r;
+}
+#endif
+
+}  // namespace
+
+int main()
+{
+  const results array = run_array();
+  print("std::array<double, 3>", array);
+  const results v = run_vec();
+  print("quantity<..., vec<3, double>>", v);
+  bool ok = std::abs(array.checksum - v.checksum) < 1e-9 * std::abs(array.checksum);
+#ifdef MP_UNITS_BENCHMARK_WG21_LA
+  const results wg21 = run_wg21();
+  print("STD_LA::fixed_size_column_vector<double, 3>", wg21);
+  ok = ok && std::abs(array.checksum - wg21.checksum) < 1e-9 * std::abs(array.checksum);
+#endif
+
+  if (!ok) {
+    std::cerr << "The kernels computed different results\n";
+    return EXIT_FAILURE;
+  }
+}
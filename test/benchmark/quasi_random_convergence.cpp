@@ -0,0 +1,112 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// SOFTWARE.
+
+// Compares the errors of estimating the mean kinetic energy over ranges of speeds, masses, and
+// temperatures with pseudo-random, Latin hypercube, Halton, and Sobol samples of a growing size.
+
+#include <mp-units/quasi_random.h>
+#include <mp-units/random.h>
+#include <mp-units/systems/isq/mechanics.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/isq/thermodynamics.h>
+#include <mp-units/systems/si/si.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <span>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+using speed = quantity<isq::speed[m / s]>;
+using mass = quantity<isq::mass[kg]>;
+using temperature = quantity<isq::thermodynamic_temperature[K]>;
+
+constexpr std::size_t max_samples = std::size_t{1} << 20;
+
+// the exact mean of `m * v^2 / 2 * T / 300 K` over the ranges below
+const quantity exact_mean = 350. * J;
+
+struct columns {
+  std::vector<speed> v = std::vector<speed>(max_samples);
+  std::vector<mass> ms = std::vector<mass>(max_samples);
+  std::vector<temperature> t = std::vector<temperature>(max_samples);
+
+  [[nodiscard]] auto spans(std::size_t n)
+  {
+    return std::tuple{std::span(v).first(n), std::span(ms).first(n), std::span(t).first(n)};
+  }
+
+  // returns the relative error of the estimate of the mean energy from the first `n` samples
+  [[nodiscard]] double error(std::size_t n) const
+  {
+    quantity<isq::energy[J]> sum = 0. * J;
+    for (std::size_t i = 0; i < n; ++i) sum += ms[i] * v[i] * v[i] / 2 * (t[i] / (300. * K));
+    return std::abs((sum / static_cast<double>(n) / exact_mean).numerical_value_in(one) - 1);
+  }
+};
+
+}  // namespace
+
+int main()
+{
+  const std::pair<speed, speed> speeds{10. * (m / s), 20. * (m / s)};
+  const std::pair<mass, mass> masses{1. * kg, 5. * kg};
+  const std::pair<temperature, temperature> temperatures{250. * K, 350. * K};
+
+  columns data;
+  double random_error = 0;
+  double sobol_error = 0;
+  std::cout << "relative errors of the mean: samples  random  latin_hypercube  halton  sobol\n";
+  for (std::size_t n = 1024; n <= max_samples; n *= 4) {
+    std::mt19937_64 gen(42);
+    auto [v, ms, t] = data.spans(n);
+    uniform_real_distribution<speed>(speeds.first, speeds.second).generate(gen, v);
+    uniform_real_distribution<mass>(masses.first, masses.second).generate(gen, ms);
+    uniform_real_distribution<temperature>(temperatures.first, temperatures.second).generate(gen, t);
+    random_error = data.error(n);
+
+    latin_hypercube_sampler<speed, mass, temperature>(speeds, masses, temperatures).generate(gen, data.spans(n));
+    const double lhs_error = data.error(n);
+
+    halton_sampler<speed, mass, temperature>(speeds, masses, temperatures).generate(data.spans(n));
+    const double halton_error = data.error(n);
+
+    const auto start = std::chrono::steady_clock::now();
+    sobol_sampler<speed, mass, temperature>(speeds, masses, temperatures).generate(data.spans(n));
+    const std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+    sobol_error = data.error(n);
+
+    std::cout << n << "  " << random_error << "  " << lhs_error << "  " << halton_error << "  " << sobol_error
+              << "  (sobol: " << time.count() / static_cast<double>(n) << " ns/sample)\n";
+  }
+
+  if (sobol_error * 10 > random_error) {
+    std::cerr << "The Sobol samples do not converge faster than the pseudo-random ones\n";
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,88 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares filling a buffer of quantities with consecutive calls to the `operator()` of the distributions
+// from _mp-units/random.h_ with filling it with their bulk `generate()`.
+
+#include "benchmark.h"
+#include <mp-units/random.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace mp_units;
+
+using length = quantity<isq::length[si::metre]>;
+
+constexpr std::size_t samples_count = 10'000'000;
+constexpr int repetitions = 3;
+
+// returns the best time in nanoseconds per sample
+const benchmark::best_time measure(repetitions, static_cast<double>(samples_count));
+
+double mean(const std::vector<length>& samples)
+{
+  double sum = 0;
+  for (const auto& x : samples) sum += x.numerical_value_in(si::metre);
+  return sum / static_cast<double>(samples.size());
+}
+
+// returns `false` if the means of the samples of both paths differ
+template<typename Dist>
+bool compare(const char* name, Dist dist, std::vector<length>& samples)
+{
+  std::mt19937_64 gen(42);
+  const double per_call = measure([&] { std::ranges::generate(samples, [&] { return dist(gen); }); });
+  const double per_call_mean = mean(samples);
+  const double bulk = measure([&] { dist.generate(gen, samples); });
+  const double bulk_mean = mean(samples);
+
+  std::cout << name << ":\n";
+  std::cout << "  operator(): " << per_call << " ns/sample\n";
+  std::cout << "  generate(): " << bulk << " ns/sample (" << per_call / bulk << "x)\n";
+  return std::abs(per_call_mean - bulk_mean) < 0.01 * (1 + std::abs(per_call_mean));
+}
+
+}  // namespace
+
+int main()
+{
+  using namespace mp_units::si::unit_symbols;
+
+  std::vector<length> samples(samples_count);
+  bool ok = compare("uniform_real_distribution", uniform_real_distribution<length>(-1 * m, 1 * m), samples);
+  ok = compare("normal_distribution", normal_distribution<length>(10 * m, 2 * m), samples) && ok;
+  ok = compare("exponential_distribution", exponential_distribution<length>(0.5), samples) && ok;
+  ok = compare("gamma_distribution (per-sample fallback)", gamma_distribution<length>(2., 1.5), samples) && ok;
+
+  if (!ok) {
+    std::cerr << "The bulk and per-call samples have different means\n";
+    return EXIT_FAILURE;
+  }
+}
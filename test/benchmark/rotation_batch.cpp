@@ -0,0 +1,91 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// SOFTWARE.
+
+
+// Compares rotating an array of `vec` velocity quantities one by one with a quaternion, one by one
+// with the equivalent rotation matrix, and in a batch stored as a structure of arrays with
+// `rotate()` from _mp-units/rotation.h_.
+
+#include "benchmark.h"
+#include <mp-units/rotation.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+constexpr std::size_t count = 1 << 20;
+constexpr int repetitions = 5;
+
+// returns the best time in nanoseconds per vector
+const benchmark::best_time measure(repetitions, static_cast<double>(count));
+
+double input(std::size_t i, std::size_t k) { return static_cast<double>((i * 7 + k * 3) % 11) - 5.; }
+
+using velocity = quantity<isq::velocity[m / s], vec<3, double>>;
+
+}  // namespace
+
+int main()
+{
+  const auto attitude = compose(quaternion<double>::from_euler(30. * deg, 5. * deg, -2. * deg),
+                                quaternion<double>::from_axis_angle(vec{0., 0., 1.}, 10. * deg));
+
+  std::vector<velocity> aos(count);
+  vector_array<isq::velocity[m / s]> soa;
+  for (std::size_t i = 0; i < count; ++i) {
+    aos[i] = vec{input(i, 0), input(i, 1), input(i, 2)} * isq::velocity[m / s];
+    soa.push_back(aos[i]);
+  }
+
+  std::vector<velocity> by_quaternion(count);
+  const double quaternion_time = measure(
+    [&] { std::ranges::transform(aos, by_quaternion.begin(), [&](const velocity& v) { return attitude * v; }); });
+
+  std::vector<velocity> by_matrix(count);
+  const double matrix_time = measure([&] {
+    const auto m = attitude.to_matrix();
+    std::ranges::transform(aos, by_matrix.begin(), [&](const velocity& v) { return m * v; });
+  });
+
+  vector_array<isq::velocity[m / s]> batched;
+  const double batched_time = measure([&] { rotate(attitude, soa, batched); });
+
+  std::cout << "quaternion * vec: " << quaternion_time << " ns, mat * vec: " << matrix_time
+            << " ns, batched rotate(): " << batched_time << " ns\n";
+
+  double max_error = 0.;
+  for (std::size_t i = 0; i < count; i += 4099) {
+    max_error = std::max(max_error, norm(by_quaternion[i] - batched[i]).numerical_value_in(m / s));
+    max_error = std::max(max_error, norm(by_matrix[i] - batched[i]).numerical_value_in(m / s));
+  }
+  if (max_error > 1e-12) {
+    std::cerr << "The rotations computed different results\n";
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,96 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares the throughput of updating a single `atomic_quantity` from many threads with the throughput
+// of updating a `sharded_counter` for 1 to 64 threads.
+//
+// The throughput of the shared atomic drops as soon as more cores contend for its cache line while
+// the sharded counter should scale with the number of cores.
+
+#include <mp-units/atomic.h>
+#include <mp-units/sharded_counter.h>
+#include <mp-units/systems/iec80000/iec80000.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace mp_units;
+
+using bytes = quantity<iec80000::byte, std::uint64_t>;
+
+constexpr int updates_per_thread = 2'000'000;
+constexpr unsigned max_threads = 64;
+
+// returns the number of updates per second in millions
+template<typename Counter>
+double measure(Counter& counter, unsigned threads)
+{
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < threads; ++t)
+    workers.emplace_back([&counter] {
+      for (int i = 0; i < updates_per_thread; ++i) counter.fetch_add(1500 * iec80000::byte);
+    });
+  for (auto& w : workers) w.join();
+  const std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(updates_per_thread) * threads / time.count() / 1e6;
+}
+
+// provides the interface used by `measure()`
+struct sharded {
+  sharded_counter<bytes> counter{max_threads};
+  void fetch_add(const bytes& q) { counter.add(q); }
+  [[nodiscard]] bytes load() const { return counter.load(); }
+};
+
+struct shared {
+  atomic_quantity<bytes> counter;
+  void fetch_add(const bytes& q) { counter.fetch_add(q, std::memory_order_relaxed); }
+  [[nodiscard]] bytes load() const { return counter.load(); }
+};
+
+}  // namespace
+
+int main()
+{
+  std::cout << "updates per second [M]:\n";
+  std::cout << std::setw(8) << "threads" << std::setw(18) << "atomic_quantity" << std::setw(18) << "sharded_counter\n";
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    shared s;
+    sharded sh;
+    const double shared_rate = measure(s, threads);
+    const double sharded_rate = measure(sh, threads);
+    std::cout << std::setw(8) << threads << std::setw(18) << shared_rate << std::setw(18) << sharded_rate << "\n";
+
+    const bytes expected = std::uint64_t{updates_per_thread} * threads * 1500 * iec80000::byte;
+    if (s.load() != expected || sh.load() != expected) {
+      std::cerr << "Updates lost\n";
+      return EXIT_FAILURE;
+    }
+  }
+}
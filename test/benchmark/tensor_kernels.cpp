@@ -0,0 +1,177 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// SOFTWARE.
+
+
+// Compares the traction (tensor-vector product) and double contraction kernels over arrays of
+// stress tensors represented with `sym_mat` and `mat` from _mp-units/tensor.h_ with the same
+// kernels over plain `std::array` values, and measures the eigen-decomposition of 3 x 3
+// symmetric tensors.
+
+#include "benchmark.h"
+#include <mp-units/systems/isq/mechanics.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <mp-units/tensor.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+constexpr std::size_t count = 1 << 18;
+constexpr int repetitions = 5;
+
+// returns the best time in nanoseconds per tensor
+const benchmark::best_time measure(repetitions, static_cast<double>(count));
+
+struct results {
+  double traction = 0, double_dot = 0;
+  double checksum = 0;
+};
+
+void print(const char* name, const results& r)
+{
+  std::cout << name << ": tensor * vec " << r.traction << " ns, double_dot " << r.double_dot << " ns\n";
+}
+
+// the components of a symmetric tensor in the order xx, yy, zz, xy, xz, yz
+std::array<double, 6> input(std::size_t i)
+{
+  std::array<double, 6> r;
+  for (std::size_t k = 0; k < 6; ++k) r[k] = static_cast<double>((i * 7 + k * 3) % 11) - 5.;
+  return r;
+}
+
+const auto normal = direction(vec{1., 2., 2.});
+
+template<typename Rep>
+Rep make_tensor(const std::array<double, 6>& c)
+{
+  const sym_mat<3, double> m{{c[0], c[3], c[4]}, {c[3], c[1], c[5]}, {c[4], c[5], c[2]}};
+  if constexpr (std::is_same_v<Rep, sym_mat<3, double>>)
+    return m;
+  else
+    return m.full();
+}
+
+template<typename Rep>
+results run_quantity()
+{
+  using stress = quantity<isq::stress[Pa], Rep>;
+  std::vector<stress> sigma(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    sigma[i] = make_tensor<Rep>(input(i)) * isq::stress[Pa];
+  }
+  const auto surface = 1. * isq::area[m2] * normal;
+  const auto epsilon = make_tensor<Rep>({1e-3, -2e-3, 5e-4, 1e-4, 0., -3e-4}) * isq::strain[one];
+
+  results r;
+  std::vector<quantity<isq::force[N], vec<3, double>>> forces(count);
+  r.traction = measure([&] {
+    std::ranges::transform(sigma, forces.begin(), [&](const stress& s) { return s * surface; });
+  });
+  std::vector<quantity<J / m3>> energy(count);
+  r.double_dot = measure(
+    [&] { std::ranges::transform(sigma, energy.begin(), [&](const stress& s) { return double_dot(s, epsilon); }); });
+  for (std::size_t i = 0; i < count; i += 4099)
+    r.checksum += forces[i].numerical_value_in(N)[1] + energy[i].numerical_value_in(J / m3);
+  return r;
+}
+
+results run_array()
+{
+  using m3 = std::array<std::array<double, 3>, 3>;
+  using v3 = std::array<double, 3>;
+  std::vector<m3> sigma(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto c = input(i);
+    sigma[i] = {{{c[0], c[3], c[4]}, {c[3], c[1], c[5]}, {c[4], c[5], c[2]}}};
+  }
+  const v3 n = {normal.numerical_value()[0], normal.numerical_value()[1], normal.numerical_value()[2]};
+  const m3 epsilon = {{{1e-3, 1e-4, 0.}, {1e-4, -2e-3, -3e-4}, {0., -3e-4, 5e-4}}};
+
+  results r;
+  std::vector<v3> forces(count);
+  r.traction = measure([&] {
+    std::ranges::transform(sigma, forces.begin(), [&](const m3& s) {
+      v3 f{};
+      for (std::size_t i = 0; i < 3; ++i)
+        for (std::size_t j = 0; j < 3; ++j) f[i] += s[i][j] * n[j];
+      return f;
+    });
+  });
+  std::vector<double> energy(count);
+  r.double_dot = measure([&] {
+    std::ranges::transform(sigma, energy.begin(), [&](const m3& s) {
+      double e = 0;
+      for (std::size_t i = 0; i < 3; ++i)
+        for (std::size_t j = 0; j < 3; ++j) e += s[i][j] * epsilon[i][j];
+      return e;
+    });
+  });
+  for (std::size_t i = 0; i < count; i += 4099) r.checksum += forces[i][1] + energy[i];
+  return r;
+}
+
+double run_eigen()
+{
+  std::vector<quantity<isq::stress[Pa], sym_mat<3, double>>> sigma(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    sigma[i] = make_tensor<sym_mat<3, double>>(input(i)) * isq::stress[Pa];
+  }
+  std::vector<quantity<Pa>> max_principal(count);
+  const double time = measure(
+    [&] { std::ranges::transform(sigma, max_principal.begin(), [](const auto& s) { return eigen(s).values[0]; }); });
+  for (std::size_t i = 0; i < count; i += 4099) {
+    const auto s = sigma[i].numerical_value();
+    // the largest principal value is not smaller than any diagonal value
+    if (max_principal[i].numerical_value_in(Pa) < std::max({s(0, 0), s(1, 1), s(2, 2)}) - 1e-9) return -1;
+  }
+  return time;
+}
+
+}  // namespace
+
+int main()
+{
+  const results array = run_array();
+  print("std::array<std::array<double, 3>, 3>", array);
+  const results sym = run_quantity<sym_mat<3, double>>();
+  print("quantity<..., sym_mat<3, double>>", sym);
+  const results full = run_quantity<mat<3, 3, double>>();
+  print("quantity<..., mat<3, 3, double>>", full);
+  const double eigen_time = run_eigen();
+  std::cout << "eigen(sym_mat<3, double>): " << eigen_time << " ns\n";
+
+  const auto same = [&](const results& r) {
+    return std::abs(array.checksum - r.checksum) < 1e-9 * std::abs(array.checksum);
+  };
+  if (!same(sym) || !same(full) || eigen_time < 0) {
+    std::cerr << "The kernels computed different results\n";
+    return EXIT_FAILURE;
+  }
+}
@@ -28,7 +28,10 @@ namespace mp_units {
 
 template<Quantity T>
 struct AlmostEqualsMatcher : Catch::Matchers::MatcherGenericBase {
-  AlmostEqualsMatcher(const T& target) : target_{target} {}
+  AlmostEqualsMatcher(const T& target, typename T::rep tolerance = std::numeric_limits<typename T::rep>::epsilon()) :
+      target_{target}, tolerance_{tolerance}
+  {
+  }
 
   template<std::convertible_to<T> U>
     requires std::same_as<typename T::rep, typename U::rep> && treat_as_floating_point<typename T::rep>
@@ -39,13 +42,14 @@ struct AlmostEqualsMatcher : Catch::Matchers::MatcherGenericBase {
     const auto x = common(target_).numerical_value();
     const auto y = common(other).numerical_value();
     const auto maxXYOne = std::max({typename T::rep{1}, abs(x), abs(y)});
-    return abs(x - y) <= std::numeric_limits<typename T::rep>::epsilon() * maxXYOne;
+    return abs(x - y) <= tolerance_ * maxXYOne;
   }
 
   std::string describe() const override { return "almost equals: " + MP_UNITS_STD_FMT::format("{}", target_); }
 
 private:
   const T& target_;
+  typename T::rep tolerance_;
 };
 
 template<Quantity T>
@@ -54,4 +58,10 @@ AlmostEqualsMatcher<T> AlmostEquals(const T& target)
   return {target};
 }
 
+template<Quantity T>
+AlmostEqualsMatcher<T> AlmostEquals(const T& target, typename T::rep tolerance)
+{
+  return {target, tolerance};
+}
+
 }  // namespace mp_units
@@ -0,0 +1,140 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <mp-units/atomic.h>
+#include <mp-units/systems/iec80000/iec80000.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+namespace {
+
+inline constexpr struct mean_sea_level : absolute_point_origin<isq::altitude> {
+} mean_sea_level;
+
+}  // namespace
+
+using bytes = quantity<iec80000::byte, std::uint64_t>;
+using distance = quantity<isq::distance[m], double>;
+using altitude = quantity_point<isq::altitude[m], mean_sea_level, int>;
+
+static_assert(atomic_quantity<bytes>::is_always_lock_free == std::atomic<std::uint64_t>::is_always_lock_free);
+static_assert(atomic_quantity<distance>::is_always_lock_free == std::atomic<double>::is_always_lock_free);
+static_assert(atomic_quantity_ref<distance>::is_always_lock_free == std::atomic_ref<double>::is_always_lock_free);
+static_assert(std::is_same_v<atomic_quantity_point<altitude>::difference_type, quantity<isq::altitude[m], int>>);
+static_assert(!std::is_copy_constructible_v<atomic_quantity<bytes>>);
+
+// only value-preserving conversions are implicit
+static_assert(std::is_invocable_v<decltype(&atomic_quantity<bytes>::fetch_add), atomic_quantity<bytes>&,
+                                  quantity<iec80000::byte, std::uint64_t>, std::memory_order>);
+static_assert(std::is_convertible_v<quantity<si::kilo<iec80000::byte>, std::uint64_t>,
+                                    atomic_quantity<bytes>::difference_type>);
+static_assert(!std::is_convertible_v<quantity<iec80000::bit, std::uint64_t>, atomic_quantity<bytes>::difference_type>);
+
+TEST_CASE("'atomic_quantity' provides atomic operations on quantities", "[atomic]")
+{
+  atomic_quantity<bytes> counter(10 * iec80000::byte);
+  CHECK(counter.load() == 10 * iec80000::byte);
+
+  SECTION("fetch_add converts units before the operation")
+  {
+    CHECK(counter.fetch_add(2 * si::kilo<iec80000::byte>) == 10 * iec80000::byte);
+    CHECK(counter.load() == 2010 * iec80000::byte);
+    CHECK(counter.fetch_sub(10 * iec80000::byte, std::memory_order_relaxed) == 2010 * iec80000::byte);
+    CHECK((counter += 1 * iec80000::byte) == 2001 * iec80000::byte);
+    CHECK((counter -= 1 * iec80000::byte) == 2000 * iec80000::byte);
+  }
+
+  SECTION("store, exchange, and compare_exchange")
+  {
+    counter = 5 * iec80000::byte;
+    CHECK(bytes(counter) == 5 * iec80000::byte);
+    CHECK(counter.exchange(7 * iec80000::byte) == 5 * iec80000::byte);
+
+    bytes expected = 1 * iec80000::byte;
+    CHECK_FALSE(counter.compare_exchange_strong(expected, 8 * iec80000::byte));
+    CHECK(expected == 7 * iec80000::byte);
+    CHECK(counter.compare_exchange_strong(expected, 8 * iec80000::byte));
+    CHECK(counter.load() == 8 * iec80000::byte);
+    while (!counter.compare_exchange_weak(expected, 9 * iec80000::byte)) {
+    }
+    CHECK(counter.load() == 9 * iec80000::byte);
+  }
+
+  SECTION("floating-point representation")
+  {
+    atomic_quantity<distance> d;
+    CHECK(d.load() == 0. * isq::distance[m]);
+    d.fetch_add(1.5 * isq::distance[km]);
+    CHECK(d.load() == 1500. * isq::distance[m]);
+  }
+}
+
+TEST_CASE("'atomic_quantity_point' shifts the point atomically", "[atomic]")
+{
+  atomic_quantity_point<altitude> alt(mean_sea_level + 100 * isq::altitude[m]);
+  CHECK(alt.fetch_add(50 * isq::altitude[m]) == mean_sea_level + 100 * isq::altitude[m]);
+  CHECK(alt.load() == mean_sea_level + 150 * isq::altitude[m]);
+  CHECK((alt -= 1 * isq::altitude[km]) == mean_sea_level - 850 * isq::altitude[m]);
+}
+
+TEST_CASE("'atomic_quantity_ref' updates existing quantities", "[atomic]")
+{
+  std::array<distance, 4> distances{};
+  atomic_quantity_ref(distances[1]).fetch_add(2. * isq::distance[km]);
+  atomic_quantity_ref(distances[1]) -= 1. * isq::distance[m];
+  CHECK(distances[1] == 1999. * isq::distance[m]);
+  CHECK(atomic_quantity_ref(distances[0]).load() == 0. * isq::distance[m]);
+
+  altitude a = mean_sea_level + 10 * isq::altitude[m];
+  atomic_quantity_ref(a).store(mean_sea_level + 20 * isq::altitude[m]);
+  CHECK(a == mean_sea_level + 20 * isq::altitude[m]);
+}
+
+TEST_CASE("'atomic_quantity' is updated concurrently without losing data", "[atomic]")
+{
+  atomic_quantity<bytes> total;
+  std::array<bytes, 2> per_slot{};
+  const int threads = 4;
+  const int iterations = 10'000;
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+    workers.emplace_back([&, t] {
+      for (int i = 0; i < iterations; ++i) {
+        total.fetch_add(1 * si::kilo<iec80000::byte>, std::memory_order_relaxed);
+        atomic_quantity_ref(per_slot[static_cast<std::size_t>(t % 2)])
+          .fetch_add(1 * iec80000::byte, std::memory_order_relaxed);
+      }
+    });
+  for (auto& w : workers) w.join();
+
+  CHECK(total.load() == threads * iterations * 1000 * iec80000::byte);
+  CHECK(per_slot[0] + per_slot[1] == threads * iterations * iec80000::byte);
+}
@@ -0,0 +1,88 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <mp-units/chrono.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <chrono>
+#include <cstdint>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+TEST_CASE("'quantity_clock' samples the underlying clock", "[chrono][clock]")
+{
+  using std::chrono::steady_clock;
+
+  SECTION("in the clock's unit")
+  {
+    using clock = quantity_clock<steady_clock>;
+    const auto before = steady_clock::now();
+    const clock::time_point now = clock::now();
+    const auto after = steady_clock::now();
+    CHECK(now >= clock::time_point(before));
+    CHECK(now <= clock::time_point(after));
+  }
+
+  SECTION("in a coarser unit")
+  {
+    using clock = quantity_clock<steady_clock, si::milli<si::second>>;
+    const auto before = std::chrono::floor<std::chrono::milliseconds>(steady_clock::now());
+    const clock::time_point now = clock::now();
+    const auto after = std::chrono::floor<std::chrono::milliseconds>(steady_clock::now());
+    CHECK(now >= clock::time_point(before));
+    CHECK(now <= clock::time_point(after));
+  }
+
+  SECTION("with a floating-point representation")
+  {
+    using clock = quantity_clock<steady_clock, si::second, double>;
+    const clock::time_point first = clock::now();
+    const clock::time_point second = clock::now();
+    CHECK(second - first >= 0 * s);
+    CHECK(second - first < 1 * s);
+  }
+}
+
+#if MP_UNITS_HAS_TSC_CLOCK
+
+TEST_CASE("'tsc_clock' follows 'steady_clock'", "[chrono][clock][tsc]")
+{
+  using clock = quantity_clock<tsc_clock>;
+  using std::chrono::steady_clock;
+
+  CHECK(tsc_clock::frequency() > 0 * Hz);
+
+  const clock::time_point tsc_start = clock::now();
+  const auto steady_start = steady_clock::now();
+  while (steady_clock::now() - steady_start < std::chrono::milliseconds(20)) {
+  }
+  const clock::time_point tsc_end = clock::now();
+  const quantity steady_elapsed{steady_clock::now() - steady_start};
+
+  // the thread may be preempted between the readings of both clocks
+  CHECK(tsc_end > tsc_start);
+  CHECK(tsc_end - tsc_start <= steady_elapsed * 5 / 4);
+  CHECK(tsc_end - tsc_start >= steady_elapsed * 3 / 4);
+}
+
+#endif  // MP_UNITS_HAS_TSC_CLOCK
@@ -0,0 +1,140 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// this test verifies the hook policy regardless of the policy selected for the project
+#undef MP_UNITS_QUANTITY_CONTRACTS
+#define MP_UNITS_QUANTITY_CONTRACTS MP_UNITS_CONTRACTS_HOOK
+
+#include <catch2/catch_all.hpp>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <mp-units/systems/si/units.h>
+#include <string_view>
+
+#if __has_include(<sys/wait.h>)
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#define MP_UNITS_TEST_FORK 1
+#endif
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+namespace {
+
+int handler_calls = 0;
+std::string_view last_expression;
+std::string_view last_function;
+
+void record(const contract_violation& v)
+{
+  ++handler_calls;
+  last_expression = v.expression;
+  last_function = v.location.function_name();
+}
+
+struct division_by_zero {};
+
+void throwing_handler(const contract_violation&) { throw division_by_zero{}; }
+
+}  // namespace
+
+// still usable in constant expressions
+static_assert((4 * isq::length[m] / (2 * isq::time[s])).numerical_value() == 2);
+
+TEST_CASE("quantity contracts hook", "[contracts]")
+{
+  reset_contract_violations();
+  handler_calls = 0;
+  const auto previous = set_contract_violation_handler(nullptr);
+
+  SECTION("valid operations do not report violations")
+  {
+    auto q = 4. * isq::length[m];
+    q /= 2.;
+    CHECK(q / (2. * isq::time[s]) == 1. * (isq::length[m] / isq::time[s]));
+    CHECK(q / 2. == 1. * isq::length[m]);
+    CHECK(contract_violations() == 0);
+  }
+
+  SECTION("violations are counted without a handler")
+  {
+    auto q = 4. * isq::length[m];
+    q /= 0.;
+    (void)(q / 0.);
+    (void)(q / (0. * isq::time[s]));
+    CHECK(contract_violations() == 3);
+  }
+
+  SECTION("handler gets the violated expression and the operation")
+  {
+    set_contract_violation_handler(record);
+    (void)(4. * isq::length[m] / (0. * isq::time[s]));
+    CHECK(contract_violations() == 1);
+    CHECK(handler_calls == 1);
+    CHECK(last_expression.find("rhs.numerical_value()") != std::string_view::npos);
+    CHECK(last_function.find("operator/") != std::string_view::npos);
+  }
+
+  SECTION("handler may prevent the operation by throwing")
+  {
+    set_contract_violation_handler(throwing_handler);
+    auto q = 4 * isq::length[m];
+    CHECK_THROWS_AS(q %= 0 * isq::length[m], division_by_zero);
+    CHECK_THROWS_AS(q % (0 * isq::length[m]), division_by_zero);
+    CHECK(q == 4 * isq::length[m]);
+    CHECK(contract_violations() == 2);
+  }
+
+  SECTION("integral division is not performed if the handler throws")
+  {
+    set_contract_violation_handler(throwing_handler);
+    auto q = 4 * isq::length[m];
+    CHECK_THROWS_AS(q /= 0, division_by_zero);
+    CHECK_THROWS_AS(q / 0, division_by_zero);
+    CHECK_THROWS_AS(q / (0 * isq::time[s]), division_by_zero);
+    CHECK(q == 4 * isq::length[m]);
+    CHECK(contract_violations() == 3);
+  }
+
+#if MP_UNITS_TEST_FORK
+  SECTION("integral division terminates if the handler returns")
+  {
+    set_contract_violation_handler(record);
+    const pid_t pid = fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0) {
+      auto q = 4 * isq::length[m];
+      q /= 0;
+      _exit(0);  // not reached
+    }
+    int status = 0;
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    CHECK(WIFSIGNALED(status));
+    CHECK(WTERMSIG(status) == SIGABRT);
+  }
+#endif
+
+  set_contract_violation_handler(previous);
+}
@@ -25,8 +25,11 @@
 #include <mp-units/random.h>
 #include <mp-units/systems/si/unit_symbols.h>
 #include <mp-units/systems/si/units.h>
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <initializer_list>
+#include <iterator>
 #include <random>
 #include <vector>
 
@@ -548,8 +551,8 @@ TEST_CASE("piecewise_constant_distribution")
       mp_units::piecewise_constant_distribution<q>(intervals_qty.cbegin(), intervals_qty.cend(), weights.cbegin());
 
     CHECK(stl_dist.intervals() == intervals_rep_vec);
-    CHECK(units_dist.intervals() == intervals_qty_vec);
-    CHECK(units_dist.densities() == stl_dist.densities());
+    CHECK(std::ranges::equal(units_dist.intervals(), intervals_qty_vec));
+    CHECK(std::ranges::equal(units_dist.densities(), stl_dist.densities()));
   }
 
   SECTION("parametrized_initializer_list")
@@ -562,8 +565,8 @@ TEST_CASE("piecewise_constant_distribution")
     auto units_dist =
       mp_units::piecewise_constant_distribution<q>(intervals_qty, [](q qty) { return qty.numerical_value(); });
 
-    CHECK(units_dist.intervals() == intervals_qty_vec);
-    CHECK(units_dist.densities() == stl_dist.densities());
+    CHECK(std::ranges::equal(units_dist.intervals(), intervals_qty_vec));
+    CHECK(std::ranges::equal(units_dist.densities(), stl_dist.densities()));
   }
 
   SECTION("parametrized_range")
@@ -576,8 +579,8 @@ TEST_CASE("piecewise_constant_distribution")
     auto units_dist =
       mp_units::piecewise_constant_distribution<q>(nw, xmin_qty, xmax_qty, [](q qty) { return qty.numerical_value(); });
 
-    CHECK(units_dist.intervals() == intervals_qty_vec);
-    CHECK(units_dist.densities() == stl_dist.densities());
+    CHECK(std::ranges::equal(units_dist.intervals(), intervals_qty_vec));
+    CHECK(std::ranges::equal(units_dist.densities(), stl_dist.densities()));
   }
 }
 
@@ -616,8 +619,8 @@ TEST_CASE("piecewise_linear_distribution")
       mp_units::piecewise_linear_distribution<q>(intervals_qty.cbegin(), intervals_qty.cend(), weights.cbegin());
 
     CHECK(stl_dist.intervals() == intervals_rep_vec);
-    CHECK(units_dist.intervals() == intervals_qty_vec);
-    CHECK(units_dist.densities() == stl_dist.densities());
+    CHECK(std::ranges::equal(units_dist.intervals(), intervals_qty_vec));
+    CHECK(std::ranges::equal(units_dist.densities(), stl_dist.densities()));
   }
 
   SECTION("parametrized_initializer_list")
@@ -630,8 +633,8 @@ TEST_CASE("piecewise_linear_distribution")
     auto units_dist =
       mp_units::piecewise_linear_distribution<q>(intervals_qty, [](q qty) { return qty.numerical_value(); });
 
-    CHECK(units_dist.intervals() == intervals_qty_vec);
-    CHECK(units_dist.densities() == stl_dist.densities());
+    CHECK(std::ranges::equal(units_dist.intervals(), intervals_qty_vec));
+    CHECK(std::ranges::equal(units_dist.densities(), stl_dist.densities()));
   }
 
   SECTION("parametrized_range")
@@ -644,7 +647,296 @@ TEST_CASE("piecewise_linear_distribution")
     auto units_dist =
       mp_units::piecewise_linear_distribution<q>(nw, xmin_qty, xmax_qty, [](q qty) { return qty.numerical_value(); });
 
-    CHECK(units_dist.intervals() == intervals_qty_vec);
-    CHECK(units_dist.densities() == stl_dist.densities());
+    CHECK(std::ranges::equal(units_dist.intervals(), intervals_qty_vec));
+    CHECK(std::ranges::equal(units_dist.densities(), stl_dist.densities()));
+  }
+}
+
+namespace {
+
+template<typename Q>
+std::pair<double, double> mean_and_stddev(const std::vector<Q>& samples)
+{
+  double sum = 0;
+  double sum_sq = 0;
+  for (const Q& x : samples) {
+    const auto v = static_cast<double>(x.numerical_value());
+    sum += v;
+    sum_sq += v * v;
+  }
+  const double n = static_cast<double>(samples.size());
+  const double mean = sum / n;
+  return {mean, std::sqrt(sum_sq / n - mean * mean)};
+}
+
+}  // namespace
+
+TEST_CASE("bulk generation")
+{
+  using q = quantity<isq::length[si::metre]>;
+  constexpr std::size_t n = 100'000;
+  std::mt19937_64 gen(42);
+
+  SECTION("uniform_real_distribution")
+  {
+    auto dist = mp_units::uniform_real_distribution<q>(2.0 * si::metre, 5.0 * si::metre);
+    std::vector<q> samples(n);
+    dist.generate(gen, samples);
+
+    CHECK(std::ranges::all_of(samples, [&](q x) { return dist.a() <= x && x < dist.b(); }));
+    const auto [mean, stddev] = mean_and_stddev(samples);
+    CHECK(std::abs(mean - 3.5) < 0.02);
+    CHECK(std::abs(stddev - 3 / std::sqrt(12.)) < 0.02);
+  }
+
+  SECTION("normal_distribution")
+  {
+    auto dist = mp_units::normal_distribution<q>(10.0 * si::metre, 2.0 * si::metre);
+    std::vector<q> samples(n + 1);  // odd count
+    dist.generate(gen, samples);
+
+    const auto [mean, stddev] = mean_and_stddev(samples);
+    CHECK(std::abs(mean - 10.) < 0.05);
+    CHECK(std::abs(stddev - 2.) < 0.05);
+
+    // a single sample
+    CHECK(std::isfinite(dist(gen).numerical_value()));
+  }
+
+  SECTION("exponential_distribution")
+  {
+    auto dist = mp_units::exponential_distribution<q>(0.5);
+    std::vector<q> samples(n);
+    dist.generate(gen, samples);
+
+    CHECK(std::ranges::all_of(samples, [](q x) { return x >= q::zero(); }));
+    const auto [mean, stddev] = mean_and_stddev(samples);
+    CHECK(std::abs(mean - 2.) < 0.05);
+    CHECK(std::abs(stddev - 2.) < 0.05);
+  }
+
+  SECTION("32-bit engines and engines with other ranges")
+  {
+    std::mt19937 gen32(42);
+    std::minstd_rand minstd(42);
+    auto dist = mp_units::uniform_real_distribution<q>(-1.0 * si::metre, 1.0 * si::metre);
+    std::vector<q> samples(n);
+
+    dist.generate(gen32, samples);
+    CHECK(std::abs(mean_and_stddev(samples).first) < 0.02);
+    dist.generate(minstd, samples);
+    CHECK(std::abs(mean_and_stddev(samples).first) < 0.02);
+  }
+
+  SECTION("distributions without a block algorithm match consecutive calls")
+  {
+    using qi = quantity<isq::length[si::metre], std::int64_t>;
+    auto dist = mp_units::poisson_distribution<qi>(4.0);
+    auto gen_copy = gen;
+    std::vector<qi> samples(1000);
+    dist.generate(gen, samples);
+
+    dist.reset();
+    CHECK(std::ranges::all_of(samples, [&](qi x) { return x == dist(gen_copy); }));
+  }
+
+  SECTION("generate_n")
+  {
+    auto dist = mp_units::gamma_distribution<q>(2.0, 1.5);
+    std::vector<q> samples;
+    dist.generate_n(gen, std::back_inserter(samples), 1000);
+    CHECK(samples.size() == 1000);
+    CHECK(std::ranges::all_of(samples, [](q x) { return x > q::zero(); }));
+  }
+}
+
+TEST_CASE("piecewise distributions share their parameters")
+{
+  using rep = double;
+  using q = quantity<isq::length[si::metre], rep>;
+
+  SECTION("piecewise_constant_distribution")
+  {
+    using dist_type = mp_units::piecewise_constant_distribution<q>;
+    const dist_type::param_type param({1.0 * si::metre, 2.0 * si::metre, 4.0 * si::metre},
+                                      [](q x) { return x.numerical_value() * x.numerical_value(); });
+    const auto stl_dist = std::piecewise_constant_distribution<rep>({1.0, 2.0, 4.0}, [](rep x) { return x * x; });
+    CHECK(std::ranges::equal(param.densities(), stl_dist.densities()));
+
+    dist_type dist1(param);
+    dist_type dist2(param);
+    CHECK(dist1.param() == param);
+    CHECK(dist1.densities().data() == dist2.densities().data());
+
+    std::mt19937_64 gen(42);
+    dist_type dist;
+    for (int i = 0; i < 100; ++i) {
+      const q x = dist(gen, param);
+      CHECK((param.intervals().front() <= x && x < param.intervals().back()));
+    }
+
+    dist.param(param);
+    CHECK(dist.max() == 4.0 * si::metre);
+
+    // the view keeps the parameters of a temporary distribution alive
+    const auto intervals = dist_type({1.0 * si::metre, 3.0 * si::metre}, [](q) { return 1.0; }).intervals();
+    CHECK(std::ranges::equal(intervals, std::array{1.0 * si::metre, 3.0 * si::metre}));
+  }
+
+  SECTION("piecewise_linear_distribution")
+  {
+    using dist_type = mp_units::piecewise_linear_distribution<q>;
+    const dist_type::param_type param({1.0 * si::metre, 2.0 * si::metre, 4.0 * si::metre},
+                                      [](q x) { return x.numerical_value() * x.numerical_value(); });
+    const auto stl_dist = std::piecewise_linear_distribution<rep>({1.0, 2.0, 4.0}, [](rep x) { return x * x; });
+    CHECK(std::ranges::equal(param.densities(), stl_dist.densities()));
+
+    std::mt19937_64 gen1(42);
+    std::mt19937_64 gen2(42);
+    dist_type dist(param);
+    auto stl_copy = stl_dist;
+    for (int i = 0; i < 100; ++i) CHECK(dist(gen1) == stl_copy(gen2) * si::metre);
+  }
+}
+
+TEST_CASE("alias_discrete_distribution")
+{
+  using rep = std::int64_t;
+  using q = quantity<isq::length[si::metre], rep>;
+
+  SECTION("default")
+  {
+    auto dist = mp_units::alias_discrete_distribution<q>();
+    std::mt19937_64 gen(42);
+    CHECK(dist.probabilities() == std::vector<double>{1.0});
+    CHECK(dist(gen) == q::zero());
+  }
+
+  SECTION("parametrized")
+  {
+    const std::vector<double> weights = {1.0, 0.0, 2.0, 5.0};
+    auto stl_dist = std::discrete_distribution<rep>(weights.begin(), weights.end());
+    auto units_dist = mp_units::alias_discrete_distribution<q>(weights.begin(), weights.end());
+
+    CHECK(units_dist.probabilities() == stl_dist.probabilities());
+    CHECK(units_dist.min() == stl_dist.min() * si::metre);
+    CHECK(units_dist.max() == stl_dist.max() * si::metre);
+
+    std::mt19937_64 gen(42);
+    std::vector<q> samples(80'000);
+    units_dist.generate(gen, samples);
+    std::array<int, 4> counts{};
+    for (const q& x : samples) ++counts[static_cast<std::size_t>(x.numerical_value())];
+    CHECK(counts[1] == 0);
+    CHECK(std::abs(counts[0] - 10'000) < 500);
+    CHECK(std::abs(counts[2] - 20'000) < 700);
+    CHECK(std::abs(counts[3] - 50'000) < 700);
+  }
+
+  SECTION("parametrized_range")
+  {
+    auto stl_dist = std::discrete_distribution<rep>(4, 0.0, 4.0, [](double x) { return x; });
+    auto units_dist = mp_units::alias_discrete_distribution<q>(4, 0.0, 4.0, [](double x) { return x; });
+    CHECK(units_dist.probabilities() == stl_dist.probabilities());
+  }
+
+  SECTION("no weights")
+  {
+    const std::vector<double> weights;
+    auto stl_dist = std::discrete_distribution<rep>(weights.begin(), weights.end());
+    auto units_dist = mp_units::alias_discrete_distribution<q>(weights.begin(), weights.end());
+    std::mt19937_64 gen(42);
+    CHECK(units_dist.probabilities() == stl_dist.probabilities());
+    CHECK(units_dist(gen) == q::zero());
+  }
+}
+
+TEST_CASE("alias piecewise distributions")
+{
+  using rep = double;
+  using q = quantity<isq::length[si::metre], rep>;
+  const std::array<q, 4> intervals = {0.0 * si::metre, 1.0 * si::metre, 3.0 * si::metre, 4.0 * si::metre};
+  const std::array<double, 4> weights = {1.0, 2.0, 0.0, 4.0};
+  std::mt19937_64 gen(42);
+  std::vector<q> samples(200'000);
+
+  SECTION("alias_piecewise_constant_distribution")
+  {
+    const std::array<rep, 4> intervals_rep = {0.0, 1.0, 3.0, 4.0};
+    auto stl_dist = std::piecewise_constant_distribution<rep>(intervals_rep.begin(), intervals_rep.end(),
+                                                              weights.begin());
+    auto units_dist =
+      mp_units::alias_piecewise_constant_distribution<q>(intervals.begin(), intervals.end(), weights.begin());
+
+    CHECK(std::ranges::equal(units_dist.intervals(), intervals));
+    CHECK(std::ranges::equal(units_dist.densities(), stl_dist.densities(),
+                             [](double a, double b) { return std::abs(a - b) < 1e-12; }));
+    CHECK(units_dist.min() == 0.0 * si::metre);
+    CHECK(units_dist.max() == 4.0 * si::metre);
+
+    // the probabilities of the intervals are 1/3, 2/3, and 0
+    units_dist.generate(gen, samples);
+    const auto [mean, stddev] = mean_and_stddev(samples);
+    CHECK(std::abs(mean - (0.5 / 3 + 2. * 2 / 3)) < 0.01);
+    CHECK(std::ranges::none_of(samples, [](q x) { return x >= 3.0 * si::metre; }));
+  }
+
+  SECTION("alias_piecewise_linear_distribution")
+  {
+    const std::array<rep, 4> intervals_rep = {0.0, 1.0, 3.0, 4.0};
+    auto stl_dist =
+      std::piecewise_linear_distribution<rep>(intervals_rep.begin(), intervals_rep.end(), weights.begin());
+    auto units_dist =
+      mp_units::alias_piecewise_linear_distribution<q>(intervals.begin(), intervals.end(), weights.begin());
+
+    CHECK(std::ranges::equal(units_dist.densities(), stl_dist.densities(),
+                             [](double a, double b) { return std::abs(a - b) < 1e-12; }));
+
+    std::vector<q> stl_samples(samples.size());
+    std::ranges::generate(stl_samples, [&] { return stl_dist(gen) * si::metre; });
+    units_dist.generate(gen, samples);
+    const auto [mean, stddev] = mean_and_stddev(samples);
+    const auto [stl_mean, stl_stddev] = mean_and_stddev(stl_samples);
+    CHECK(std::abs(mean - stl_mean) < 0.02);
+    CHECK(std::abs(stddev - stl_stddev) < 0.02);
+  }
+
+  SECTION("initializer_list")
+  {
+    auto stl_dist = std::piecewise_linear_distribution<rep>({1.0, 2.0, 4.0}, [](rep x) { return x * x; });
+    auto units_dist = mp_units::alias_piecewise_linear_distribution<q>(
+      {1.0 * si::metre, 2.0 * si::metre, 4.0 * si::metre},
+      [](q x) { return x.numerical_value_in(si::metre) * x.numerical_value_in(si::metre); });
+    CHECK(std::ranges::equal(units_dist.densities(), stl_dist.densities(),
+                             [](double a, double b) { return std::abs(a - b) < 1e-12; }));
+    const q x = units_dist(gen);
+    CHECK((1.0 * si::metre <= x && x <= 4.0 * si::metre));
+  }
+
+  SECTION("fewer than 2 boundaries")
+  {
+    // the weights are not read
+    const double* no_weights = nullptr;
+    auto constant_dist =
+      mp_units::alias_piecewise_constant_distribution<q>(intervals.begin(), intervals.begin() + 1, no_weights);
+    auto linear_dist =
+      mp_units::alias_piecewise_linear_distribution<q>(intervals.begin(), intervals.begin(), no_weights);
+    CHECK(std::ranges::equal(constant_dist.densities(), std::vector<double>{1.0}));
+    CHECK(std::ranges::equal(linear_dist.densities(), std::vector<double>{1.0, 1.0}));
+    CHECK(constant_dist.min() == 0.0 * si::metre);
+    CHECK(linear_dist.max() == 1.0 * si::metre);
+  }
+
+  SECTION("float representation")
+  {
+    using qf = quantity<isq::length[si::metre], float>;
+    auto units_dist = mp_units::alias_piecewise_constant_distribution<qf>(
+      100'000, 0.f * si::metre, 100'000.f * si::metre, [](qf) { return 1.0; });
+    std::vector<qf> float_samples(samples.size());
+    units_dist.generate(gen, float_samples);
+    double sum = 0;
+    for (qf x : float_samples) sum += static_cast<double>(x.numerical_value_in(si::metre));
+    CHECK(std::abs(sum / static_cast<double>(float_samples.size()) - 50'000.) < 500.);
+    CHECK(std::ranges::all_of(float_samples, [](qf x) { return 0.f * si::metre <= x && x < 100'000.f * si::metre; }));
   }
 }
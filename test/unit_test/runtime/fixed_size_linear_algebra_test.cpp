@@ -0,0 +1,133 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/linear_algebra.h>
+#include <mp-units/systems/isq/mechanics.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <cstdint>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+static_assert(is_vector<vec<3, double>>);
+static_assert(is_tensor<mat<3, 3, double>>);
+static_assert(RepresentationOf<vec<3, int>, quantity_character::vector>);
+static_assert(RepresentationOf<mat<3, 3, double>, quantity_character::tensor>);
+
+// padded and aligned for SIMD
+static_assert(sizeof(vec<3, double>) == 32 && alignof(vec<3, double>) == 32);
+static_assert(sizeof(vec<3, float>) == 16 && alignof(vec<3, float>) == 16);
+static_assert(sizeof(vec<2, double>) == 16);
+static_assert(sizeof(vec<6, double>) == 64);
+static_assert(sizeof(mat<3, 3, double>) == 3 * 32);
+
+static_assert(vec{1, 2, 3} + vec{1., 1., 1.} == vec{2., 3., 4.});
+static_assert(std::is_same_v<decltype(vec{1, 2, 3} * 0.5), vec<3, double>>);
+static_assert(dot(vec{1, 2, 3}, vec{4, 5, 6}) == 32);
+static_assert(cross(vec{1, 0, 0}, vec{0, 1, 0}) == vec{0, 0, 1});
+static_assert(mat<2, 3, int>{{1, 2, 3}, {4, 5, 6}} * vec{1, 0, -1} == vec{-2, -2});
+static_assert(transpose(mat<2, 3, int>{{1, 2, 3}, {4, 5, 6}}) == mat<3, 2, int>{{1, 4}, {2, 5}, {3, 6}});
+static_assert(mat<2, 2, int>{{1, 2}, {3, 4}} * mat<2, 2, int>{{5, 6}, {7, 8}} == mat<2, 2, int>{{19, 22}, {43, 50}});
+static_assert(mat<3, 3, int>::identity() * vec{7, 8, 9} == vec{7, 8, 9});
+
+TEST_CASE("'vec' as a representation of vector quantities", "[la]")
+{
+  SECTION("cast of unit")
+  {
+    const auto v = vec{3, 2, 1} * isq::position_vector[km];
+    CHECK(v.in(m).numerical_value() == vec{3000, 2000, 1000});
+    CHECK(value_cast<km>(vec{1001, 1002, 1003} * isq::position_vector[m]).numerical_value() == vec{1, 1, 1});
+    CHECK((vec{1., 2., 3.} * isq::position_vector[km]).in(m).numerical_value() == vec{1000., 2000., 3000.});
+  }
+
+  SECTION("arithmetic")
+  {
+    const auto v = vec{1, 2, 3} * isq::position_vector[m];
+    CHECK((2 * v).numerical_value() == vec{2, 4, 6});
+    CHECK((v * 0.5).numerical_value() == vec{0.5, 1., 1.5});
+    CHECK((v / 0.5).numerical_value() == vec{2., 4., 6.});
+    CHECK((v + vec{3, 2, 1} * isq::position_vector[km]).numerical_value() == vec{3001, 2002, 1003});
+    CHECK((v - vec{3, 2, 1} * isq::position_vector[m]).numerical_value() == vec{-2, 0, 2});
+    CHECK((-v).numerical_value() == vec{-1, -2, -3});
+  }
+
+  SECTION("multiply by scalar quantity")
+  {
+    const auto v = vec{1, 2, 3} * isq::velocity[m / s];
+    const quantity<isq::momentum[N * s], vec<3, int>> momentum = 2 * isq::mass[kg] * v;
+    CHECK(momentum.numerical_value() == vec{2, 4, 6});
+
+    const quantity<isq::velocity[km / h], vec<3, double>> velocity =
+      vec{30., 20., 10.} * isq::position_vector[km] / (0.5 * isq::duration[h]);
+    CHECK(velocity.numerical_value() == vec{60., 40., 20.});
+  }
+
+  SECTION("a matrix transforms vector quantities")
+  {
+    const mat<3, 3, int> swap_xy = {{0, 1, 0}, {1, 0, 0}, {0, 0, 1}};
+    const auto v = vec{1, 2, 3} * isq::velocity[m / s];
+    CHECK(swap_xy * v == vec{2, 1, 3} * isq::velocity[m / s]);
+  }
+}
+
+TEST_CASE("vector quantity products", "[la]")
+{
+  SECTION("dot")
+  {
+    const auto f = vec{1., 2., 0.} * isq::force[N];
+    const auto d = vec{3., 4., 5.} * isq::displacement[m];
+    const quantity<isq::mechanical_work[J]> work = dot(f, d);
+    CHECK(work == 11. * isq::mechanical_work[J]);
+  }
+
+  SECTION("cross")
+  {
+    const auto r = vec{3, 0, 0} * isq::position_vector[m];
+    const auto f = vec{0, 10, 0} * isq::force[N];
+    const quantity<isq::moment_of_force[N * m], vec<3, int>> moment = cross(r, f);
+    CHECK(moment == vec{0, 0, 30} * isq::moment_of_force[N * m]);
+  }
+
+  SECTION("norm")
+  {
+    const auto v = vec{2., 3., 6.} * isq::velocity[km / h];
+    const quantity<isq::speed[km / h]> speed = norm(v);
+    CHECK(speed == 7. * isq::speed[km / h]);
+  }
+}
+
+TEST_CASE("'mat' arithmetic", "[la]")
+{
+  const mat<2, 2, double> a = {{1, 2}, {3, 4}};
+  CHECK(a(0, 1) == 2);
+  CHECK(a.row(1) == vec{3., 4.});
+  CHECK(a.col(1) == vec{2., 4.});
+  CHECK(a + a == 2 * a);
+  CHECK(a - a == mat<2, 2, double>{});
+  CHECK(a / 2 == mat<2, 2, double>{{0.5, 1}, {1.5, 2}});
+  CHECK(-a * mat<2, 2, double>::identity() == -a);
+
+  const mat<2, 2, std::int64_t> b(mat<2, 2, int>{{1, 2}, {3, 4}});
+  CHECK(b(1, 0) == 3);
+}
@@ -0,0 +1,155 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <mp-units/geographic.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using Catch::Matchers::WithinAbs;
+using Catch::Matchers::WithinRel;
+
+namespace {
+
+// degrees, minutes, and seconds of arc
+constexpr quantity<si::degree> dms(double d, double m, double sec)
+{
+  const double sign = d < 0 ? -1. : 1.;
+  return sign * (std::abs(d) + m / 60 + sec / 3600) * deg;
+}
+
+}  // namespace
+
+TEST_CASE("haversine distance and initial bearing", "[geographic]")
+{
+  const geographic_position<> origin{0. * deg, 0. * deg};
+  const geographic_position<> london{51.5074 * deg, -0.1278 * deg};
+  const geographic_position<> paris{48.8566 * deg, 2.3522 * deg};
+
+  SECTION("single positions")
+  {
+    CHECK_THAT(haversine_distance(origin, {0. * deg, 90. * deg}).numerical_value_in(m),
+               WithinAbs(earth_mean_radius.numerical_value_in(m) * std::numbers::pi / 2, 1e-6));
+    CHECK_THAT(haversine_distance(london, paris).numerical_value_in(m), WithinAbs(343'556.5, 1.));
+    CHECK_THAT(haversine_distance(london, paris, 6'371. * isq::radius[km]).numerical_value_in(m),
+               WithinAbs(343'556., 1.));
+    CHECK(haversine_distance(paris, paris) == 0. * isq::distance[m]);
+
+    CHECK_THAT(initial_bearing(origin, {0. * deg, 90. * deg}).numerical_value_in(deg), WithinAbs(90., 1e-9));
+    CHECK_THAT(initial_bearing(origin, {10. * deg, 0. * deg}).numerical_value_in(deg), WithinAbs(0., 1e-9));
+    CHECK_THAT(initial_bearing(origin, {0. * deg, -10. * deg}).numerical_value_in(deg), WithinAbs(270., 1e-9));
+    CHECK_THAT(initial_bearing(origin, {-10. * deg, 0. * deg}).numerical_value_in(deg), WithinAbs(180., 1e-9));
+  }
+
+  SECTION("batched")
+  {
+    geographic_positions<> from;
+    geographic_positions<> to;
+    for (int i = 0; i < 50; ++i) {
+      from.push_back({(i - 25.) * deg, (3. * i - 70.) * deg});
+      to.push_back({(40. - i) * deg, (170. - 7. * i) * deg});
+    }
+    REQUIRE(from.size() == 50);
+    CHECK_THAT(from[3].latitude.numerical_value_in(rad), WithinAbs((-22. * deg).numerical_value_in(rad), 1e-12));
+
+    std::vector<geographic_distance<>> distances(to.size());
+    std::vector<geographic_bearing<>> bearings(to.size());
+    haversine_distance(from, to, distances);
+    initial_bearing(from, to, bearings);
+    for (std::size_t i = 0; i < to.size(); ++i) {
+      CHECK(distances[i] == haversine_distance(from[i], to[i]));
+      CHECK(bearings[i] == initial_bearing(from[i], to[i]));
+    }
+
+    haversine_distance(london, to, distances);
+    initial_bearing(london, to, bearings);
+    for (std::size_t i = 0; i < to.size(); ++i) {
+      CHECK_THAT(distances[i].numerical_value_in(m),
+                 WithinAbs(haversine_distance(london, to[i]).numerical_value_in(m), 1e-6));
+      CHECK_THAT(bearings[i].numerical_value_in(deg),
+                 WithinAbs(initial_bearing(london, to[i]).numerical_value_in(deg), 1e-9));
+    }
+  }
+}
+
+TEST_CASE("Vincenty's inverse method", "[geographic]")
+{
+  SECTION("the example from Vincenty's paper")
+  {
+    // Flinders Peak to Buninyong on the GRS 80 ellipsoid
+    const ellipsoid grs80{6'378'137. * isq::radius[m], 1 / 298.257222101};
+    const geographic_position<> flinders_peak{dms(-37, 57, 3.72030), dms(144, 25, 29.52440)};
+    const geographic_position<> buninyong{dms(-37, 39, 10.15610), dms(143, 55, 35.38390)};
+    const auto g = vincenty_inverse(flinders_peak, buninyong, grs80);
+    CHECK_THAT(g.distance.numerical_value_in(m), WithinAbs(54'972.271, 1e-3));
+    CHECK_THAT(g.initial_bearing.numerical_value_in(deg), WithinAbs(dms(306, 52, 5.37).numerical_value_in(deg), 1e-5));
+  }
+
+  SECTION("quarter of the equator and of a meridian on WGS 84")
+  {
+    const geographic_position<> origin{0. * deg, 0. * deg};
+    const auto equator = vincenty_inverse(origin, {0. * deg, 90. * deg});
+    CHECK_THAT(equator.distance.numerical_value_in(m), WithinAbs(10'018'754.171, 1e-3));
+    CHECK_THAT(equator.initial_bearing.numerical_value_in(deg), WithinAbs(90., 1e-9));
+    const auto meridian = vincenty_inverse(origin, {90. * deg, 0. * deg});
+    CHECK_THAT(meridian.distance.numerical_value_in(m), WithinAbs(10'001'965.729, 1e-3));
+    CHECK_THAT(meridian.initial_bearing.numerical_value_in(deg), WithinAbs(0., 1e-9));
+    CHECK(vincenty_inverse(origin, origin).distance == 0. * isq::distance[m]);
+  }
+
+  SECTION("nearly antipodal positions")
+  {
+    const auto g = vincenty_inverse(geographic_position<>{0. * deg, 0. * deg}, {0.5 * deg, 179.7 * deg});
+    CHECK(std::isnan(g.distance.numerical_value_in(m)));
+  }
+
+  SECTION("batched")
+  {
+    geographic_positions<> from;
+    geographic_positions<> to;
+    for (int i = 0; i < 50; ++i) {
+      from.push_back({(i - 25.) * deg, (3. * i - 70.) * deg});
+      to.push_back({(40. - i) * deg, (100. - 7. * i) * deg});
+    }
+    std::vector<geographic_distance<>> distances(to.size());
+    std::vector<geographic_bearing<>> bearings(to.size());
+    vincenty_inverse(from, to, distances, bearings);
+    std::vector<geographic_distance<>> spherical(to.size());
+    haversine_distance(from, to, spherical);
+    for (std::size_t i = 0; i < to.size(); ++i) {
+      const auto g = vincenty_inverse(from[i], to[i]);
+      CHECK(distances[i] == g.distance);
+      CHECK(bearings[i] == g.initial_bearing);
+      // the spherical model differs from the ellipsoid by less than 0.6%
+      CHECK_THAT(spherical[i].numerical_value_in(m), WithinRel(distances[i].numerical_value_in(m), 0.006));
+    }
+
+    vincenty_inverse(from[7], to, distances);
+    for (std::size_t i = 0; i < to.size(); ++i) CHECK(distances[i] == vincenty_inverse(from[7], to[i]).distance);
+  }
+}
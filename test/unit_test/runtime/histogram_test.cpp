@@ -0,0 +1,173 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "almost_equals.h"
+#include <catch2/catch_all.hpp>
+#include <mp-units/histogram.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+using length = quantity<isq::length[m]>;
+using latency = quantity<isq::time[us]>;
+
+static_assert(std::is_same_v<histogram<length>::value_type, length>);
+static_assert(std::is_same_v<histogram<quantity<isq::length[m], int>>::value_type, length>);
+static_assert(std::is_same_v<quantile_sketch<latency>::value_type, latency>);
+
+TEST_CASE("'histogram' with linear bins", "[histogram]")
+{
+  // edges provided in another unit are converted once
+  histogram<length> hist(linear_bins<length>(0. * km, 1. * km, 10));
+  REQUIRE(hist.size() == 10);
+  CHECK(hist.lower_edge(0) == 0. * isq::length[m]);
+  CHECK_THAT(hist.upper_edge(9), AlmostEquals(1000. * isq::length[m]));
+
+  for (int i = 0; i < 1000; ++i) hist.record((i + 0.5) * isq::length[m]);
+  hist.record(-1. * isq::length[m]);
+  hist.record(1. * isq::length[km]);
+
+  CHECK(hist.total() == 1002);
+  CHECK(hist.underflow() == 1);
+  CHECK(hist.overflow() == 1);
+  for (std::size_t i = 0; i < hist.size(); ++i) CHECK(hist.count(i) == 100);
+
+  SECTION("quantiles")
+  {
+    CHECK(hist.quantile(0.) == 0. * isq::length[m]);
+    CHECK_THAT(hist.quantile(0.5), AlmostEquals(500. * isq::length[m]));
+    CHECK_THAT(hist.quantile(0.25), AlmostEquals(249.5 * isq::length[m]));
+    CHECK_THAT(hist.quantile(1.), AlmostEquals(1000. * isq::length[m]));
+  }
+
+  SECTION("bulk recording")
+  {
+    const std::vector<length> samples = {50. * m, 150. * m, 150. * m};
+    auto other = hist.empty_copy();
+    other.record(samples);
+    CHECK(other.total() == 3);
+    CHECK(other.count(0) == 1);
+    CHECK(other.count(1) == 2);
+  }
+
+  SECTION("merging")
+  {
+    auto other = hist.empty_copy();
+    other.record(50. * m);
+    hist.merge(other);
+    CHECK(hist.count(0) == 101);
+    CHECK(hist.total() == 1003);
+  }
+
+  SECTION("reset")
+  {
+    hist.reset();
+    CHECK(hist.total() == 0);
+  }
+}
+
+TEST_CASE("'histogram' with log bins", "[histogram]")
+{
+  histogram<latency, log_bins<latency>> hist(log_bins<latency>(1. * us, 1. * s, 6));
+  REQUIRE(hist.size() == 6);
+  CHECK_THAT(hist.lower_edge(1), AlmostEquals(10. * isq::time[us]));
+  CHECK_THAT(hist.upper_edge(5), AlmostEquals(1e6 * isq::time[us]));
+  CHECK(std::abs(hist.bins().ratio() - 10.) < 1e-12);
+
+  hist.record(0.5 * isq::time[us]);
+  hist.record(2. * isq::time[us]);
+  hist.record(20. * isq::time[us]);
+  hist.record(2. * isq::time[ms]);
+  hist.record(2. * isq::time[ms]);
+  hist.record(2. * isq::time[s]);
+
+  CHECK(hist.underflow() == 1);
+  CHECK(hist.count(0) == 1);
+  CHECK(hist.count(1) == 1);
+  CHECK(hist.count(2) == 0);
+  CHECK(hist.count(3) == 2);
+  CHECK(hist.overflow() == 1);
+
+  // interpolated geometrically within a bin
+  const auto median_of_bin = std::sqrt(10.) * 1000. * isq::time[us];
+  CHECK(abs(hist.quantile(4. / 6) - median_of_bin) < 1e-9 * median_of_bin);
+}
+
+TEST_CASE("'quantile_sketch' estimates quantiles within the relative accuracy", "[histogram][quantile_sketch]")
+{
+  const double alpha = 0.01;
+  quantile_sketch<latency> sketch(1. * ns, 1. * s, alpha);
+  CHECK(sketch.relative_accuracy() == alpha);
+
+  // log-uniform samples from 10 us to 100 ms
+  const int n = 10'000;
+  std::vector<latency> samples;
+  for (int i = 0; i < n; ++i) samples.push_back(10. * std::pow(1e4, (i + 0.5) / n) * isq::time[us]);
+
+  auto shard1 = sketch.empty_copy();
+  auto shard2 = sketch.empty_copy();
+  shard1.record(std::span(samples).first(n / 2));
+  for (const auto& x : std::span(samples).subspan(n / 2)) shard2.record(x);
+  sketch.merge(shard1);
+  sketch.merge(shard2);
+  REQUIRE(sketch.count() == n);
+
+  for (double p : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+    const auto expected = samples[static_cast<std::size_t>(std::ceil(p * n)) - 1];
+    const auto estimated = sketch.quantile(p);
+    CHECK(abs(estimated - expected) <= alpha * expected);
+  }
+
+  SECTION("out of range values are clamped")
+  {
+    auto other = sketch.empty_copy();
+    other.record(0. * isq::time[us]);
+    other.record(1. * isq::time[h]);
+    CHECK(other.quantile(0.) == 1. * isq::time[ns]);
+    CHECK(other.quantile(1.) == 1. * isq::time[s]);
+  }
+}
+
+TEST_CASE("'histogram' shards can be merged concurrently", "[histogram]")
+{
+  histogram<length> total(linear_bins<length>(0. * m, 100. * m, 100));
+  const int threads = 4;
+  const int samples = 10'000;
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+    workers.emplace_back([&total] {
+      auto shard = total.empty_copy();
+      for (int i = 0; i < samples; ++i) shard.record((i % 100 + 0.5) * isq::length[m]);
+      total.merge(shard);
+    });
+  for (auto& w : workers) w.join();
+
+  CHECK(total.total() == threads * samples);
+  for (std::size_t i = 0; i < total.size(); ++i) CHECK(total.count(i) == threads * samples / 100);
+}
@@ -0,0 +1,191 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "almost_equals.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <mp-units/kalman_filter.h>
+#include <mp-units/math.h>
+#include <mp-units/quantity_point.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/isq/thermodynamics.h>
+#include <mp-units/systems/si/si.h>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+namespace {
+
+using position = quantity<isq::height[m]>;
+using velocity = quantity<isq::speed[m / s]>;
+using acceleration = quantity<isq::speed[m / s] / isq::time[s]>;
+
+}  // namespace
+
+TEST_CASE("kalman_covariance", "[kalman]")
+{
+  using covariance = kalman_covariance<position, velocity>;
+
+  SECTION("diagonal")
+  {
+    const auto p = covariance::diagonal(4. * pow<2>(isq::height[m]), 1. * pow<2>(isq::speed[m / s]));
+    CHECK(p.get<0, 0>() == 4. * pow<2>(isq::height[m]));
+    CHECK(p.get<1, 1>() == 1. * pow<2>(isq::speed[m / s]));
+    CHECK(p.get<0, 1>() == 0. * (isq::height[m] * isq::speed[m / s]));
+  }
+
+  SECTION("elements are symmetric")
+  {
+    covariance p;
+    p.set<1, 0>(2. * (isq::speed[m / s] * isq::height[m]));
+    CHECK(p.get<0, 1>() == 2. * (isq::height[m] * isq::speed[m / s]));
+    CHECK(p.get<0, 1>().numerical_value_in(m2 / s) == 2.);
+  }
+
+  SECTION("piecewise white noise")
+  {
+    // the acceleration noise affects the position by dt²/2 and the velocity by dt
+    const auto q = covariance::piecewise_white_noise(2. * s, 0.5 * (m2 / pow<4>(s)));
+    CHECK_THAT((q.get<0, 0>()), AlmostEquals(2. * m2, 1e-9));
+    CHECK_THAT((q.get<0, 1>()), AlmostEquals(2. * (m2 / s), 1e-9));
+    CHECK_THAT((q.get<1, 1>()), AlmostEquals(2. * (m2 / s2), 1e-9));
+  }
+}
+
+TEST_CASE("kalman_filter", "[kalman]")
+{
+  SECTION("update of a single state variable")
+  {
+    kalman_filter<position> f{std::tuple{60. * isq::height[m]},
+                              kalman_covariance<position>::diagonal(225. * pow<2>(isq::height[m]))};
+    f.update(48.54 * isq::height[m], 25. * pow<2>(isq::height[m]));
+    // the gain is 225 / (225 + 25) = 0.9
+    CHECK_THAT(f.get<0>(), AlmostEquals(49.686 * isq::height[m], 1e-9));
+    CHECK_THAT((f.covariance().get<0, 0>()), AlmostEquals(22.5 * pow<2>(isq::height[m]), 1e-9));
+  }
+
+  SECTION("prediction")
+  {
+    using covariance = kalman_covariance<position, velocity>;
+    kalman_filter f{std::tuple{10. * isq::height[m], 2. * isq::speed[m / s]},
+                    covariance::diagonal(4. * pow<2>(isq::height[m]), 1. * pow<2>(isq::speed[m / s]))};
+    f.predict(2. * s, covariance{});
+    CHECK_THAT(f.get<0>(), AlmostEquals(14. * isq::height[m], 1e-9));
+    CHECK_THAT(f.get<1>(), AlmostEquals(2. * isq::speed[m / s], 1e-9));
+    CHECK_THAT((f.covariance().get<0, 0>()), AlmostEquals(8. * m2, 1e-9));
+    CHECK_THAT((f.covariance().get<0, 1>()), AlmostEquals(2. * (m2 / s), 1e-9));
+    CHECK_THAT((f.covariance().get<1, 1>()), AlmostEquals(1. * (m2 / s2), 1e-9));
+  }
+
+  SECTION("state variables in different units")
+  {
+    using distance = quantity<isq::distance[km]>;
+    using speed = quantity<isq::speed[m / s]>;
+    using covariance = kalman_covariance<distance, speed>;
+    kalman_filter f{std::tuple{1. * isq::distance[km], 10. * isq::speed[m / s]},
+                    covariance::diagonal(0. * pow<2>(isq::distance[km]), 1. * pow<2>(isq::speed[m / s]))};
+    f.predict(100. * s, covariance{});
+    CHECK_THAT(f.get<0>(), AlmostEquals(2. * isq::distance[km], 1e-9));
+    CHECK_THAT((f.covariance().get<0, 0>()), AlmostEquals(10'000. * m2, 1e-9));
+    CHECK_THAT((f.covariance().get<0, 1>()), AlmostEquals(100. * (m2 / s), 1e-9));
+    CHECK_THAT(f.covariance().values()(0, 0), Catch::Matchers::WithinAbs(0.01, 1e-9));
+  }
+
+  SECTION("quantity point state")
+  {
+    constexpr auto deg_C = isq::Celsius_temperature[si::degree_Celsius];
+    using temperature = decltype(si::ice_point + 0. * deg_C);
+    kalman_filter<temperature> f{std::tuple{si::ice_point + 10. * deg_C},
+                                 kalman_covariance<temperature>::diagonal(10'000. * (deg_C * deg_C))};
+    f.update(si::ice_point + 50. * deg_C, 0. * (deg_C * deg_C));
+    CHECK_THAT(f.get<0>().quantity_from_origin(), AlmostEquals(50. * deg_C, 1e-9));
+    CHECK(f.covariance().get<0, 0>() == 0. * (deg_C * deg_C));
+  }
+
+  SECTION("tracking of a constant acceleration")
+  {
+    using covariance = kalman_covariance<position, velocity, acceleration>;
+    const auto a = 2. * (m / s2);
+    kalman_filter f{std::tuple{position{}, velocity{}, acceleration{}},
+                    covariance::diagonal(500. * m2, 500. * (m2 / s2), 500. * (m2 / pow<4>(s)))};
+    const auto q = covariance::piecewise_white_noise(1. * s, 1e-6 * (m2 / pow<6>(s)));
+    for (int i = 1; i <= 50; ++i) {
+      const auto t = static_cast<double>(i) * s;
+      f.predict(1. * s, q);
+      f.update(position{a * t * t / 2}, 1. * m2);
+    }
+    CHECK_THAT(f.get<2>(), AlmostEquals(acceleration{a}, 1e-2));
+    CHECK_THAT(f.get<1>(), AlmostEquals(velocity{a * (50. * s)}, 1e-2));
+  }
+}
+
+TEST_CASE("kalman_filters", "[kalman]")
+{
+  using covariance = kalman_covariance<position, velocity, acceleration>;
+  using filter = kalman_filter<position, velocity, acceleration>;
+  // not a multiple of the number of lanes
+  const std::size_t count = 3 * kalman_filters<position, velocity, acceleration>::lanes + 1;
+
+  std::vector<filter> expected;
+  kalman_filters<position, velocity, acceleration> batch;
+  batch.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto v = static_cast<double>(i);
+    expected.emplace_back(std::tuple{v * isq::height[m], -v * isq::speed[m / s], acceleration{}},
+                          covariance::diagonal((100. + v) * m2, 10. * (m2 / s2), 1. * (m2 / pow<4>(s))));
+    batch.push_back(expected.back());
+  }
+  REQUIRE(batch.size() == count);
+  CHECK(batch[count - 1] == expected.back());
+
+  const auto q = covariance::piecewise_white_noise(0.1 * s, 0.01 * (m2 / pow<6>(s)));
+  std::vector<position> measured(count);
+  for (int step = 1; step <= 20; ++step) {
+    for (std::size_t i = 0; i < count; ++i)
+      measured[i] = static_cast<double>((i * 7 + static_cast<std::size_t>(step) * 13) % 17) * isq::height[m];
+    batch.predict(0.1 * s, q);
+    batch.update(measured, 4. * m2);
+    for (std::size_t i = 0; i < count; ++i) {
+      expected[i].predict(0.1 * s, q);
+      expected[i].update(measured[i], 4. * m2);
+    }
+  }
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const filter f = batch[i];
+    CHECK_THAT(f.get<0>(), AlmostEquals(expected[i].get<0>(), 1e-9));
+    CHECK_THAT(f.get<1>(), AlmostEquals(expected[i].get<1>(), 1e-9));
+    CHECK_THAT(f.get<2>(), AlmostEquals(expected[i].get<2>(), 1e-9));
+    CHECK_THAT((f.covariance().get<0, 0>()), AlmostEquals(expected[i].covariance().get<0, 0>(), 1e-9));
+    CHECK_THAT((f.covariance().get<0, 2>()), AlmostEquals(expected[i].covariance().get<0, 2>(), 1e-9));
+    CHECK_THAT((f.covariance().get<1, 2>()), AlmostEquals(expected[i].covariance().get<1, 2>(), 1e-9));
+    CHECK_THAT((f.covariance().get<2, 2>()), AlmostEquals(expected[i].covariance().get<2, 2>(), 1e-9));
+  }
+
+  batch.set(0, expected[1]);
+  CHECK(batch[0] == expected[1]);
+  batch.clear();
+  CHECK(batch.empty());
+}
@@ -0,0 +1,117 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <mp-units/parallel_random.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace mp_units;
+
+static_assert(std::uniform_random_bit_generator<philox4x32>);
+
+// known answers from the Random123 library
+static_assert(philox4x32::bijection({0, 0, 0, 0}, {0, 0}) ==
+              std::array<std::uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+static_assert(philox4x32::bijection({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+              std::array<std::uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+static_assert(philox4x32::bijection({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+              std::array<std::uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+
+TEST_CASE("'philox4x32' engine", "[random][philox4x32]")
+{
+  philox4x32 gen(42);
+  std::vector<std::uint32_t> values(10);
+  std::ranges::generate(values, std::ref(gen));
+  CHECK(gen.position() == 10);
+
+  SECTION("the first values come from the bijection of the counter")
+  {
+    const auto block = philox4x32::bijection({0, 0, 0, 0}, {42, 0});
+    CHECK(std::ranges::equal(block, std::span(values).first(4)));
+  }
+
+  SECTION("discard and seek jump to any position")
+  {
+    philox4x32 other(42);
+    other.discard(7);
+    CHECK(other() == values[7]);
+    other.seek(2);
+    CHECK(other() == values[2]);
+    other.seek(9);
+    CHECK(other() == values[9]);
+    CHECK(other == gen);
+  }
+
+  SECTION("seeding restarts the sequence")
+  {
+    gen.seed(42);
+    CHECK(gen.position() == 0);
+    CHECK(gen() == values[0]);
+    CHECK(gen.get_seed() == 42);
+  }
+
+  SECTION("streams and substreams are independent")
+  {
+    auto s1 = gen.split(1);
+    auto s2 = gen.split_substream(1);
+    CHECK(s1.stream() == 1);
+    CHECK(s1.position() == 0);
+    CHECK(s2.substream() == 1);
+    CHECK(s1() != values[0]);
+    CHECK(s2() != values[0]);
+    CHECK(s1 != s2);
+  }
+}
+
+TEST_CASE("'parallel_generate' does not depend on the number of threads", "[random][parallel_generate]")
+{
+  using q = quantity<isq::length[si::metre]>;
+  const philox4x32 engine(2023, 7);
+
+  auto check = [&](const auto& dist) {
+    std::vector<q> reference(100'000);
+    parallel_generate(dist, engine, std::span(reference), 1, 1000);
+    for (unsigned threads : {2u, 3u, 8u}) {
+      std::vector<q> samples(reference.size());
+      parallel_generate(dist, engine, std::span(samples), threads, 1000);
+      CHECK(samples == reference);
+    }
+
+    // chunks are filled from consecutive substreams
+    std::vector<q> chunk(1000);
+    auto d = dist;
+    auto gen = engine.split_substream(3);
+    d.generate(gen, std::span(chunk));
+    CHECK(std::ranges::equal(chunk, std::span(reference).subspan(3000, 1000)));
+  };
+
+  check(mp_units::normal_distribution<q>(1. * si::metre, 2. * si::metre));
+  check(mp_units::gamma_distribution<q>(2., 1.));
+  check(mp_units::uniform_real_distribution<q>(0. * si::metre, 1. * si::metre));
+}
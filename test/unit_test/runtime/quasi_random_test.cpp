@@ -0,0 +1,254 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <mp-units/quasi_random.h>
+#include <mp-units/systems/isq/mechanics.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/isq/thermodynamics.h>
+#include <mp-units/systems/si/si.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <tuple>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+namespace {
+
+using speed = quantity<isq::speed[m / s]>;
+using mass = quantity<isq::mass[kg]>;
+using temperature = quantity<isq::thermodynamic_temperature[K]>;
+
+// checks that every one of the `n` equal subintervals of [0, 1) holds exactly one of the values
+template<typename Values>
+bool stratified(const Values& values, std::size_t n)
+{
+  std::vector<int> hits(n);
+  for (double u : values) {
+    if (u < 0 || u >= 1) return false;
+    ++hits[static_cast<std::size_t>(u * static_cast<double>(n))];
+  }
+  return std::ranges::all_of(hits, [](int h) { return h == 1; });
+}
+
+}  // namespace
+
+TEST_CASE("'sobol_sequence'", "[random][quasi_random]")
+{
+  SECTION("the first points of two dimensions")
+  {
+    sobol_sequence<2> seq;
+    const std::array<std::array<double, 2>, 8> expected = {
+      {{0, 0}, {0.5, 0.5}, {0.75, 0.25}, {0.25, 0.75}, {0.375, 0.375}, {0.875, 0.875}, {0.625, 0.125}, {0.125, 0.625}}};
+    for (const auto& p : expected) CHECK(seq() == p);
+    CHECK(seq.position() == 8);
+  }
+
+  SECTION("the first 2^m points of every dimension are stratified")
+  {
+    constexpr std::size_t dims = 21;
+    constexpr std::size_t n = 1024;
+    sobol_sequence<dims> seq;
+    std::vector<std::array<double, dims>> points(n);
+    std::ranges::generate(points, std::ref(seq));
+    for (std::size_t d = 0; d < dims; ++d) {
+      std::vector<double> column(n);
+      std::ranges::transform(points, column.begin(), [&](const auto& p) { return p[d]; });
+      CHECK(stratified(column, n));
+    }
+  }
+
+  SECTION("the first two dimensions form a (0, m, 2)-net")
+  {
+    constexpr std::size_t m = 6;
+    sobol_sequence<2> seq;
+    std::vector<std::array<double, 2>> points(std::size_t{1} << m);
+    std::ranges::generate(points, std::ref(seq));
+    // every elementary interval of the area 2^-m holds exactly one point
+    for (std::size_t k = 0; k <= m; ++k) {
+      const double nx = static_cast<double>(std::size_t{1} << k);
+      const double ny = static_cast<double>(std::size_t{1} << (m - k));
+      std::vector<int> hits(points.size());
+      for (const auto& p : points)
+        ++hits[static_cast<std::size_t>(p[0] * nx) * (std::size_t{1} << (m - k)) + static_cast<std::size_t>(p[1] * ny)];
+      CHECK(std::ranges::all_of(hits, [](int h) { return h == 1; }));
+    }
+  }
+
+  SECTION("seek jumps to any point")
+  {
+    sobol_sequence<5> seq;
+    std::vector<std::array<double, 5>> points(100);
+    std::ranges::generate(points, std::ref(seq));
+    sobol_sequence<5> other(37);
+    CHECK(other() == points[37]);
+    other.seek(99);
+    CHECK(other() == points[99]);
+    other.seek(3);
+    other.discard(50);
+    CHECK(other() == points[53]);
+    CHECK(other.position() == 54);
+  }
+}
+
+TEST_CASE("'halton_sequence'", "[random][quasi_random]")
+{
+  halton_sequence<3> seq;
+  CHECK(seq() == std::array<double, 3>{0, 0, 0});
+  CHECK(seq() == std::array<double, 3>{1. / 2, 1. / 3, 1. / 5});
+  CHECK(seq() == std::array<double, 3>{1. / 4, 2. / 3, 2. / 5});
+  CHECK(seq() == std::array<double, 3>{3. / 4, 1. / 9, 3. / 5});
+
+  halton_sequence<3> other(2);
+  CHECK(other() == std::array<double, 3>{1. / 4, 2. / 3, 2. / 5});
+
+  // the first 3^k points of the second dimension are stratified
+  halton_sequence<2> h;
+  std::vector<double> column(81);
+  std::ranges::generate(column, [&] { return h()[1]; });
+  CHECK(stratified(column, 81));
+}
+
+TEST_CASE("'low_discrepancy_sampler' of quantities", "[random][quasi_random]")
+{
+  const std::pair<speed, speed> speeds{10. * (m / s), 20. * (m / s)};
+  const std::pair<mass, mass> masses{1. * kg, 5. * kg};
+  const std::pair<temperature, temperature> temperatures{250. * K, 350. * K};
+
+  sobol_sampler<speed, mass, temperature> sampler(speeds, masses, temperatures);
+  CHECK(sampler.min() == std::tuple{10. * (m / s), 1. * kg, 250. * K});
+  CHECK(sampler.max() == std::tuple{20. * (m / s), 5. * kg, 350. * K});
+
+  SECTION("samples are mapped to the ranges")
+  {
+    CHECK(sampler() == std::tuple{10. * (m / s), 1. * kg, 250. * K});
+    CHECK(sampler() == std::tuple{15. * (m / s), 3. * kg, 300. * K});
+    CHECK(sampler() == std::tuple{17.5 * (m / s), 2. * kg, 275. * K});
+  }
+
+  SECTION("tuples and columns hold the same samples")
+  {
+    constexpr std::size_t n = 1000;
+    std::vector<std::tuple<speed, mass, temperature>> rows(n);
+    sampler.generate(rows);
+    CHECK(sampler.position() == n);
+
+    std::vector<speed> sp(n);
+    std::vector<mass> ms(n);
+    std::vector<temperature> t(n);
+    sampler.seek(0);
+    sampler.generate(std::span(sp), std::span(ms), std::span(t));
+    for (std::size_t i = 0; i < n; ++i) CHECK(rows[i] == std::tuple{sp[i], ms[i], t[i]});
+  }
+
+  SECTION("parallel generation gives the same samples for any number of threads")
+  {
+    constexpr std::size_t n = 10'000;
+    sampler.discard(5);
+    std::vector<std::tuple<speed, mass, temperature>> expected(n);
+    auto copy = sampler;
+    copy.generate(expected);
+
+    for (unsigned threads : {1u, 3u, 8u}) {
+      std::vector<std::tuple<speed, mass, temperature>> rows(n);
+      parallel_generate(sampler, std::span(rows), threads, 1000);
+      CHECK(rows == expected);
+
+      std::vector<speed> sp(n);
+      std::vector<mass> ms(n);
+      std::vector<temperature> t(n);
+      parallel_generate(sampler, std::tuple{std::span(sp), std::span(ms), std::span(t)}, threads, 999);
+      bool same = true;
+      for (std::size_t i = 0; i < n; ++i) same = same && expected[i] == std::tuple{sp[i], ms[i], t[i]};
+      CHECK(same);
+    }
+    CHECK(sampler.position() == 5);
+  }
+
+  SECTION("halton sampler")
+  {
+    halton_sampler<speed, mass> h(speeds, masses);
+    h();
+    CHECK(h() == std::tuple{15. * (m / s), 1. * kg + 4. / 3 * kg});
+  }
+}
+
+TEST_CASE("'latin_hypercube_sampler' of quantities", "[random][quasi_random]")
+{
+  const latin_hypercube_sampler<speed, mass, speed> sampler({10. * (m / s), 20. * (m / s)}, {1. * kg, 5. * kg},
+                                                            {-1. * (m / s), 1. * (m / s)});
+  constexpr std::size_t n = 500;
+
+  const auto normalized = [](auto column, auto lo, auto hi) {
+    std::vector<double> u(column.size());
+    std::ranges::transform(column, u.begin(), [&](auto q) { return ((q - lo) / (hi - lo)).numerical_value_in(one); });
+    return u;
+  };
+
+  SECTION("every dimension has exactly one sample in each stratum")
+  {
+    std::mt19937_64 gen(42);
+    std::vector<speed> sp(n);
+    std::vector<mass> ms(n);
+    std::vector<speed> v(n);
+    sampler.generate(gen, std::span(sp), std::span(ms), std::span(v));
+    CHECK(stratified(normalized(sp, 10. * (m / s), 20. * (m / s)), n));
+    CHECK(stratified(normalized(ms, 1. * kg, 5. * kg), n));
+    CHECK(stratified(normalized(v, -1. * (m / s), 1. * (m / s)), n));
+  }
+
+  SECTION("tuples")
+  {
+    std::mt19937_64 gen(42);
+    std::vector<std::tuple<speed, mass, speed>> rows(n);
+    sampler.generate(gen, rows);
+    std::vector<mass> ms(n);
+    std::ranges::transform(rows, ms.begin(), [](const auto& r) { return std::get<1>(r); });
+    CHECK(stratified(normalized(ms, 1. * kg, 5. * kg), n));
+  }
+
+  SECTION("parallel generation gives the same design for any number of threads")
+  {
+    const philox4x32 engine(42);
+    std::vector<speed> sp1(n), sp2(n);
+    std::vector<mass> ms1(n), ms2(n);
+    std::vector<speed> v1(n), v2(n);
+    parallel_generate(sampler, engine, std::tuple{std::span(sp1), std::span(ms1), std::span(v1)}, 1);
+    parallel_generate(sampler, engine, std::tuple{std::span(sp2), std::span(ms2), std::span(v2)}, 3);
+    CHECK(sp1 == sp2);
+    CHECK(ms1 == ms2);
+    CHECK(v1 == v2);
+    CHECK(stratified(normalized(v1, -1. * (m / s), 1. * (m / s)), n));
+
+    // the dimensions are generated with separate substreams
+    auto gen = engine.split_substream(1);
+    std::vector<mass> ms3(n);
+    sampler.generate_column<1>(gen, std::span(ms3));
+    CHECK(ms3 == ms1);
+  }
+}
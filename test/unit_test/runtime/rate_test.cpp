@@ -0,0 +1,113 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "almost_equals.h"
+#include <catch2/catch_all.hpp>
+#include <mp-units/rate.h>
+#include <mp-units/systems/iec80000/iec80000.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <cstdint>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+namespace {
+
+inline constexpr struct start : absolute_point_origin<isq::time> {
+} start;
+
+using timestamp = quantity_point<isq::time[ms], start, std::int64_t>;
+using bytes = quantity<iec80000::byte, std::int64_t>;
+
+timestamp at(std::int64_t t) { return start + t * isq::time[ms]; }
+
+}  // namespace
+
+static_assert(std::is_same_v<rate_meter<timestamp, bytes>::rate_type,
+                             quantity<iec80000::byte / isq::time[ms], double>>);
+
+TEST_CASE("'rate_meter' reports the rate over a sliding window", "[rate][rate_meter]")
+{
+  rate_meter<timestamp, bytes, 10> meter(1000 * isq::time[ms]);
+  REQUIRE(meter.window() == 1000 * isq::time[ms]);
+
+  SECTION("with no records the rate is zero")
+  {
+    CHECK(meter.rate(at(500)) == 0 * (iec80000::byte / isq::time[ms]));
+  }
+
+  SECTION("in a partially filled window")
+  {
+    meter.record(at(0), 100 * iec80000::byte);
+    meter.record(at(50), 100 * iec80000::byte);
+    CHECK(meter.total() == 200 * iec80000::byte);
+    // the window is assumed to be full: 9 previous buckets and 50 ms of the current one
+    CHECK_THAT(meter.rate(at(50)), AlmostEquals(200. * iec80000::byte / (950. * isq::time[ms])));
+  }
+
+  SECTION("with a steady stream")
+  {
+    for (std::int64_t t = 0; t < 5000; t += 10) meter.record(at(t), 10 * iec80000::byte);
+    CHECK_THAT(meter.rate(at(5000)).in(iec80000::byte / s), AlmostEquals(1000. * (iec80000::byte / s)));
+    CHECK(meter.total() == 5000 * iec80000::byte);
+  }
+
+  SECTION("old records leave the window")
+  {
+    meter.record(at(0), 100 * iec80000::byte);
+    meter.record(at(1500), 100 * iec80000::byte);
+    CHECK_THAT(meter.rate(at(1550)), AlmostEquals(100. * iec80000::byte / (950. * isq::time[ms])));
+    CHECK(meter.rate(at(3000)) == 0 * (iec80000::byte / isq::time[ms]));
+  }
+
+  SECTION("the window never ends before the latest record")
+  {
+    meter.record(at(1500), 100 * iec80000::byte);
+    CHECK(meter.rate(at(0)) == meter.rate(at(1500)));
+  }
+}
+
+TEST_CASE("'ewma' smooths irregularly sampled values", "[rate][ewma]")
+{
+  ewma<timestamp, quantity<iec80000::byte / s>> avg(1000 * isq::time[ms]);
+
+  CHECK(avg.value() == 0 * (iec80000::byte / s));
+
+  avg.update(at(0), 100. * (iec80000::byte / s));
+  CHECK(avg.value() == 100. * (iec80000::byte / s));
+
+  SECTION("a sample after one time constant has a weight of 1 - 1/e")
+  {
+    avg.update(at(1000), 200. * (iec80000::byte / s));
+    CHECK_THAT(avg.value(), AlmostEquals((200. - 100. / std::exp(1.)) * (iec80000::byte / s)));
+  }
+
+  SECTION("the result does not depend on the sampling frequency")
+  {
+    ewma<timestamp, quantity<iec80000::byte / s>> fine(1000 * isq::time[ms]);
+    fine.update(at(0), 100. * (iec80000::byte / s));
+    for (std::int64_t t = 100; t <= 1000; t += 100) fine.update(at(t), 200. * (iec80000::byte / s));
+    avg.update(at(1000), 200. * (iec80000::byte / s));
+    CHECK_THAT(fine.value(), AlmostEquals(avg.value()));
+  }
+}
@@ -0,0 +1,177 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <mp-units/chrono.h>
+#include <mp-units/ring_buffer.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+using length = quantity<isq::length[mm], std::int64_t>;
+using timestamp = quantity_point<isq::time[ns], chrono_point_origin<std::chrono::steady_clock>, std::int64_t>;
+
+static_assert(std::is_trivially_copyable_v<length>);
+static_assert(std::is_trivially_copyable_v<timestamp>);
+static_assert(std::is_same_v<spsc_ring_buffer<length>::value_type, length>);
+static_assert(std::is_same_v<mpmc_ring_buffer<timestamp>::value_type, timestamp>);
+
+namespace {
+
+template<typename Buffer>
+void check_single_threaded()
+{
+  Buffer buffer(5);
+  REQUIRE(buffer.capacity() == 8);
+  CHECK_FALSE(buffer.try_pop().has_value());
+
+  SECTION("values are converted before they are enqueued")
+  {
+    CHECK(buffer.try_push(1 * isq::length[m]));
+    CHECK(buffer.try_push(2 * isq::length[mm]));
+    CHECK(buffer.try_pop() == 1000 * isq::length[mm]);
+    CHECK(buffer.try_pop() == 2 * isq::length[mm]);
+    CHECK_FALSE(buffer.try_pop().has_value());
+  }
+
+  SECTION("bulk operations wrap around and stop when full or empty")
+  {
+    std::vector<length> in;
+    for (std::int64_t i = 0; i < 10; ++i) in.push_back(i * isq::length[mm]);
+
+    CHECK(buffer.try_push(std::span<const length>(in).first(5)) == 5);
+    std::array<length, 3> out{};
+    CHECK(buffer.try_pop(std::span(out)) == 3);
+    CHECK(out == std::array<length, 3>{0 * isq::length[mm], 1 * isq::length[mm], 2 * isq::length[mm]});
+
+    // wraps around the end of the storage
+    CHECK(buffer.try_push(in) == 6);
+    CHECK_FALSE(buffer.try_push(1 * isq::length[mm]));
+
+    std::array<length, 10> rest{};
+    CHECK(buffer.try_pop(std::span(rest)) == 8);
+    CHECK(rest[0] == 3 * isq::length[mm]);
+    CHECK(rest[1] == 4 * isq::length[mm]);
+    CHECK(rest[2] == 0 * isq::length[mm]);
+    CHECK(rest[7] == 5 * isq::length[mm]);
+    CHECK(buffer.try_pop(std::span(rest)) == 0);
+  }
+
+  SECTION("bulk push converts the values to the unit of the buffer")
+  {
+    const std::vector<quantity<isq::length[m], std::int64_t>> in{1 * isq::length[m], 2 * isq::length[m],
+                                                                 3 * isq::length[m]};
+    std::array<length, 6> out{};
+    CHECK(buffer.try_push(std::span<const length>(out)) == 6);
+    CHECK(buffer.try_pop(std::span(out)) == 6);
+
+    // wraps around the end of the storage
+    CHECK(buffer.try_push(std::span(in)) == 3);
+    CHECK(buffer.try_pop(std::span(out)) == 3);
+    CHECK(out[0] == 1000 * isq::length[mm]);
+    CHECK(out[1] == 2000 * isq::length[mm]);
+    CHECK(out[2] == 3000 * isq::length[mm]);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("'spsc_ring_buffer' stores quantities", "[ring_buffer]")
+{
+  check_single_threaded<spsc_ring_buffer<length>>();
+}
+
+TEST_CASE("'mpmc_ring_buffer' stores quantities", "[ring_buffer]")
+{
+  check_single_threaded<mpmc_ring_buffer<length>>();
+}
+
+TEST_CASE("'spsc_ring_buffer' transfers quantity points between threads", "[ring_buffer]")
+{
+  spsc_ring_buffer<timestamp> buffer(64);
+  const std::int64_t count = 100'000;
+  const auto origin = chrono_point_origin<std::chrono::steady_clock>;
+
+  std::thread producer([&] {
+    for (std::int64_t i = 0; i < count;)
+      if (buffer.try_push(origin + i * isq::time[ns])) ++i;
+  });
+
+  // a monitoring thread may observe both indices change
+  std::atomic<bool> done = false;
+  bool bounded = true;
+  std::thread monitor([&] {
+    while (!done.load(std::memory_order_relaxed)) bounded = bounded && buffer.size() <= buffer.capacity();
+  });
+
+  bool ordered = true;
+  std::int64_t received = 0;
+  std::array<timestamp, 16> batch{};
+  while (received < count) {
+    const std::size_t n = buffer.try_pop(std::span(batch));
+    for (std::size_t i = 0; i < n; ++i) ordered = ordered && batch[i] == origin + received++ * isq::time[ns];
+  }
+  producer.join();
+  done = true;
+  monitor.join();
+
+  CHECK(ordered);
+  CHECK(bounded);
+  CHECK(buffer.empty());
+}
+
+TEST_CASE("'mpmc_ring_buffer' transfers every value exactly once", "[ring_buffer]")
+{
+  mpmc_ring_buffer<length> buffer(64);
+  const int producers = 3;
+  const int consumers = 3;
+  const std::int64_t per_producer = 20'000;
+
+  std::atomic<std::int64_t> sum{0};
+  std::atomic<std::int64_t> received{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p)
+    threads.emplace_back([&] {
+      for (std::int64_t i = 1; i <= per_producer;)
+        if (buffer.try_push(i * isq::length[mm])) ++i;
+    });
+  for (int c = 0; c < consumers; ++c)
+    threads.emplace_back([&] {
+      std::array<length, 8> batch{};
+      while (received.load() < producers * per_producer) {
+        const std::size_t n = buffer.try_pop(std::span(batch));
+        for (std::size_t i = 0; i < n; ++i) sum += batch[i].numerical_value_in(mm);
+        received += static_cast<std::int64_t>(n);
+      }
+    });
+  for (auto& t : threads) t.join();
+
+  CHECK(received.load() == producers * per_producer);
+  CHECK(sum.load() == producers * per_producer * (per_producer + 1) / 2);
+}
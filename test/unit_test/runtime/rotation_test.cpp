@@ -0,0 +1,126 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/rotation.h>
+#include <mp-units/systems/angular/angular.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <cmath>
+#include <numbers>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+namespace {
+
+bool near(const vec<3, double>& a, const vec<3, double>& b, double tolerance = 1e-12)
+{
+  return norm(a - b) < tolerance;
+}
+
+template<Quantity Q>
+bool near(const Q& a, const Q& b, double tolerance = 1e-12)
+{
+  return near(a.numerical_value(), b.numerical_value(), tolerance);
+}
+
+}  // namespace
+
+TEST_CASE("'quaternion' rotations", "[rotation]")
+{
+  const vec<3, double> x_axis{1, 0, 0};
+  const vec<3, double> y_axis{0, 1, 0};
+  const vec<3, double> z_axis{0, 0, 1};
+
+  SECTION("identity")
+  {
+    CHECK(quaternion<double>::identity() * vec{1., 2., 3.} == vec{1., 2., 3.});
+    CHECK(quaternion<double>::identity().angle() == 0. * rad);
+  }
+
+  SECTION("axis and angle in different angular units")
+  {
+    const auto q1 = quaternion<double>::from_axis_angle(z_axis, 90. * deg);
+    const auto q2 = quaternion<double>::from_axis_angle(z_axis * 5., std::numbers::pi / 2 * rad);
+    const auto q3 = quaternion<double>::from_axis_angle(z_axis, 90 * angular::unit_symbols::deg);
+    CHECK(near(q1 * x_axis, y_axis));
+    CHECK(near(q2 * x_axis, y_axis));
+    CHECK(near(q3 * x_axis, y_axis));
+    CHECK(std::abs(q1.angle().numerical_value_in(deg) - 90.) < 1e-12);
+  }
+
+  SECTION("euler angles")
+  {
+    // yaw turns the x axis (north) towards the y axis (east)
+    CHECK(near(quaternion<double>::from_euler(90. * deg, 0. * deg, 0. * deg) * x_axis, y_axis));
+    // pitch turns the x axis (nose) up, i.e. against the z axis (down)
+    CHECK(near(quaternion<double>::from_euler(0. * deg, 90. * deg, 0. * deg) * x_axis, -z_axis));
+    // roll turns the y axis (right wing) down
+    CHECK(near(quaternion<double>::from_euler(0. * deg, 0. * deg, 90. * deg) * y_axis, z_axis));
+
+    const auto q = quaternion<double>::from_euler(30. * deg, 20. * deg, 10. * deg);
+    const auto expected = quaternion<double>::from_axis_angle(z_axis, 30. * deg) *
+                          quaternion<double>::from_axis_angle(y_axis, 20. * deg) *
+                          quaternion<double>::from_axis_angle(x_axis, 10. * deg);
+    const vec<3, double> v{1, 2, 3};
+    CHECK(near(q * v, expected * v));
+  }
+
+  SECTION("composition, inverse, and matrix")
+  {
+    const auto a = quaternion<double>::from_axis_angle(vec{1., 1., 0.}, 40. * deg);
+    const auto b = quaternion<double>::from_axis_angle(vec{0., 1., 2.}, -75. * deg);
+    const vec<3, double> v{3, -1, 2};
+    CHECK(near((a * b) * v, a * (b * v)));
+    CHECK(near(compose(a, b, a.inverse()) * v, a * (b * (a.inverse() * v))));
+    CHECK(near(a.inverse() * (a * v), v));
+    CHECK(near(a.to_matrix() * v, a * v));
+    CHECK(std::abs(norm(a * v) - norm(v)) < 1e-12);
+  }
+}
+
+TEST_CASE("rotation of vector quantities", "[rotation]")
+{
+  const auto attitude = quaternion<double>::from_euler(90. * deg, 0. * deg, 0. * deg);
+  const auto v_body = vec{10., 0., 1.} * isq::velocity[m / s];
+
+  SECTION("keeps the reference")
+  {
+    const quantity<isq::velocity[m / s], vec<3, double>> v_ned = attitude * v_body;
+    CHECK(near(v_ned, vec{0., 10., 1.} * isq::velocity[m / s]));
+    CHECK(near(attitude.to_matrix() * v_body, v_ned));
+  }
+
+  SECTION("batched rotation of a structure of arrays")
+  {
+    vector_array<isq::velocity[m / s]> velocities;
+    for (int i = 0; i < 100; ++i) velocities.push_back(vec{1. * i, 2., -1. * i} * isq::velocity[m / s]);
+    vector_array<isq::velocity[m / s]> rotated;
+    rotate(attitude, velocities, rotated);
+    REQUIRE(rotated.size() == 100);
+    for (std::size_t i = 0; i < rotated.size(); ++i) CHECK(near(rotated[i], attitude * velocities[i]));
+
+    rotate(attitude.inverse(), rotated);
+    for (std::size_t i = 0; i < rotated.size(); ++i) CHECK(near(rotated[i], velocities[i], 1e-9));
+  }
+}
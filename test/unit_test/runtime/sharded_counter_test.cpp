@@ -0,0 +1,78 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_all.hpp>
+#include <mp-units/sharded_counter.h>
+#include <mp-units/systems/iec80000/iec80000.h>
+#include <mp-units/systems/si/si.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::iec80000::unit_symbols;
+
+using bytes = quantity<iec80000::byte, std::uint64_t>;
+
+static_assert(alignof(sharded_counter<bytes>) <= alignof(std::max_align_t));
+static_assert(!std::is_copy_constructible_v<sharded_counter<bytes>>);
+
+TEST_CASE("'sharded_counter' sums the updates of all the threads", "[sharded_counter]")
+{
+  sharded_counter<bytes> counter(4);
+  REQUIRE(counter.shards() == 4);
+  CHECK(counter.load() == 0 * B);
+
+  SECTION("single thread")
+  {
+    counter.add(10 * B);
+    counter += 1 * kB;
+    counter.sub(5 * B);
+    counter -= 5 * B;
+    CHECK(counter.load() == 1000 * B);
+    CHECK(counter.load_in(iec80000::bit) == 8000 * iec80000::bit);
+    counter.reset();
+    CHECK(counter.load() == 0 * B);
+  }
+
+  SECTION("many threads")
+  {
+    const int threads = 8;
+    const int iterations = 10'000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+      workers.emplace_back([&] {
+        for (int i = 0; i < iterations; ++i) counter += 2 * B;
+      });
+    for (auto& w : workers) w.join();
+    CHECK(counter.load() == threads * iterations * 2 * B);
+  }
+}
+
+TEST_CASE("'sharded_counter' uses all the hardware threads by default", "[sharded_counter]")
+{
+  sharded_counter<quantity<si::joule>> energy;
+  CHECK(energy.shards() >= std::thread::hardware_concurrency());
+  CHECK(std::has_single_bit(energy.shards()));
+  energy += 1.5 * si::kilo<si::joule>;
+  CHECK(energy.load() == 1500. * si::joule);
+}
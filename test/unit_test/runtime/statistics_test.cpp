@@ -0,0 +1,144 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "almost_equals.h"
+#include <catch2/catch_all.hpp>
+#include <mp-units/statistics.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <cstdint>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+static_assert(std::is_same_v<running_stats<quantity<isq::length[m]>>::value_type, quantity<isq::length[m]>>);
+static_assert(
+  std::is_same_v<running_stats<quantity<isq::length[m], int>>::value_type, quantity<isq::length[m], double>>);
+static_assert(QuantityOf<running_stats<quantity<isq::length[m]>>::variance_type, isq::area>);
+static_assert(QuantityOf<decltype(running_stats<quantity<isq::length[m]>>{}.stddev()), isq::length>);
+static_assert(QuantityOf<running_covariance<quantity<isq::length[m]>, quantity<isq::time[s]>>::covariance_type,
+                         isq::length * isq::time>);
+
+// constant evaluation
+static_assert([] {
+  running_stats<quantity<isq::length[m], int>> stats;
+  for (int i = 1; i <= 4; ++i) stats.push(i * isq::length[m]);
+  return stats.mean() == 2.5 * isq::length[m] && stats.variance() == 1.25 * isq::area[m2] &&
+         stats.min() == 1. * isq::length[m] && stats.max() == 4. * isq::length[m];
+}());
+
+TEST_CASE("'running_stats' computes the mean and the variance of quantities", "[statistics][running_stats]")
+{
+  const std::vector<quantity<isq::length[m]>> samples = {2. * m, 4. * m, 4. * m, 4. * m, 5. * m, 5. * m, 7. * m,
+                                                         9. * m};
+
+  SECTION("one by one")
+  {
+    running_stats<quantity<isq::length[m]>> stats;
+    for (const auto& x : samples) stats.push(x);
+    REQUIRE(stats.count() == 8);
+    CHECK(stats.mean() == 5. * isq::length[m]);
+    CHECK(stats.variance() == 4. * isq::area[m2]);
+    CHECK_THAT(stats.sample_variance(), AlmostEquals(32. / 7. * isq::area[m2]));
+    CHECK(stats.stddev() == 2. * isq::length[m]);
+    CHECK(stats.min() == 2. * isq::length[m]);
+    CHECK(stats.max() == 9. * isq::length[m]);
+  }
+
+  SECTION("in bulk")
+  {
+    running_stats<quantity<isq::length[m]>> stats;
+    stats.push(samples);
+    REQUIRE(stats.count() == 8);
+    CHECK(stats.mean() == 5. * isq::length[m]);
+    CHECK(stats.variance() == 4. * isq::area[m2]);
+    CHECK(stats.min() == 2. * isq::length[m]);
+    CHECK(stats.max() == 9. * isq::length[m]);
+  }
+
+  SECTION("merged from partial results")
+  {
+    running_stats<quantity<isq::length[m]>> first;
+    running_stats<quantity<isq::length[m]>> second;
+    first.push(std::span(samples).first(3));
+    for (const auto& x : std::span(samples).subspan(3)) second.push(x);
+    first.merge(second);
+    REQUIRE(first.count() == 8);
+    CHECK_THAT(first.mean(), AlmostEquals(5. * isq::length[m]));
+    CHECK_THAT(first.variance(), AlmostEquals(4. * isq::area[m2]));
+    CHECK(first.min() == 2. * isq::length[m]);
+    CHECK(first.max() == 9. * isq::length[m]);
+  }
+
+  SECTION("numerically stable for large offsets")
+  {
+    std::vector<quantity<isq::length[m]>> shifted;
+    for (const auto& x : samples) shifted.push_back(x + 1e9 * isq::length[m]);
+    running_stats<quantity<isq::length[m]>> one_by_one;
+    for (const auto& x : shifted) one_by_one.push(x);
+    running_stats<quantity<isq::length[m]>> bulk;
+    bulk.push(shifted);
+    // a naive sum of squares would lose all the significant digits here
+    CHECK(abs(one_by_one.variance() - 4. * isq::area[m2]) < 1e-6 * isq::area[m2]);
+    CHECK(abs(bulk.variance() - 4. * isq::area[m2]) < 1e-6 * isq::area[m2]);
+  }
+}
+
+TEST_CASE("'running_covariance' computes the covariance of pairs of quantities", "[statistics][running_covariance]")
+{
+  std::vector<quantity<isq::time[s]>> times;
+  std::vector<quantity<isq::length[m]>> distances;
+  for (int i = 0; i < 100; ++i) {
+    times.push_back(i * 1. * isq::time[s]);
+    distances.push_back(i * 3. * isq::length[m] + (i % 2 == 0 ? 1. : -1.) * isq::length[m]);
+  }
+  // covariance of a series 0..99 with itself
+  const quantity time_variance = (100. * 100. - 1.) / 12. * (isq::time * isq::time)[s2];
+
+  // the alternating offset decreases the slope of the regression line slightly below 3 m/s
+  const quantity slope = (3. - 0.5 / 833.25) * isq::speed[m / s];
+
+  running_stats<quantity<isq::time[s]>> time_stats;
+  time_stats.push(times);
+  CHECK_THAT(time_stats.variance(), AlmostEquals(time_variance));
+
+  SECTION("one by one")
+  {
+    running_covariance<quantity<isq::time[s]>, quantity<isq::length[m]>> cov;
+    for (std::size_t i = 0; i < times.size(); ++i) cov.push(times[i], distances[i]);
+    CHECK_THAT(cov.mean_x(), AlmostEquals(49.5 * isq::time[s]));
+    CHECK_THAT(cov.mean_y(), AlmostEquals(148.5 * isq::length[m]));
+    CHECK_THAT(cov.covariance() / time_stats.variance(), AlmostEquals(slope));
+  }
+
+  SECTION("in bulk and merged")
+  {
+    running_covariance<quantity<isq::time[s]>, quantity<isq::length[m]>> cov;
+    running_covariance<quantity<isq::time[s]>, quantity<isq::length[m]>> other;
+    cov.push(std::span(times).first(37), std::span(distances).first(37));
+    other.push(std::span(times).subspan(37), std::span(distances).subspan(37));
+    cov.merge(other);
+    REQUIRE(cov.count() == 100);
+    CHECK_THAT(cov.covariance() / time_stats.variance(), AlmostEquals(slope));
+  }
+}
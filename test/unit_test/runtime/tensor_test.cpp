@@ -0,0 +1,153 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/systems/isq/mechanics.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <mp-units/tensor.h>
+#include <cmath>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+static_assert(is_tensor<sym_mat<3, double>>);
+static_assert(RepresentationOf<sym_mat<3, double>, quantity_character::tensor>);
+static_assert(sizeof(sym_mat<3, double>) == 64);
+
+static_assert(sym_mat<3, int>{{1, 2, 3}, {2, 4, 5}, {3, 5, 6}}.values() == vec{1, 4, 6, 2, 3, 5});
+static_assert(sym_mat<3, int>{{1, 2, 3}, {2, 4, 5}, {3, 5, 6}}.full() ==
+              mat<3, 3, int>{{1, 2, 3}, {2, 4, 5}, {3, 5, 6}});
+static_assert(sym_mat<3, int>{{1, 2, 3}, {2, 4, 5}, {3, 5, 6}} * vec{1, 0, -1} == vec{-2, -3, -3});
+static_assert(vec{1, 0, -1} * mat<3, 2, int>{{1, 2}, {3, 4}, {5, 6}} == vec{-4, -4});
+static_assert(sym_mat<2, int>{{1, 2}, {2, 3}} + sym_mat<2, int>::identity() == sym_mat<2, int>{{2, 2}, {2, 4}});
+static_assert(sym_mat<2, int>{{1, 2}, {2, 3}} * sym_mat<2, int>{{1, 0}, {0, 2}} == mat<2, 2, int>{{1, 4}, {2, 6}});
+static_assert(symmetric_part(mat<2, 2, int>{{1, 2}, {4, 3}}) == sym_mat<2, int>{{1, 3}, {3, 3}});
+static_assert(outer(vec{1, 2}, vec{3, 4, 5}) == mat<2, 3, int>{{3, 4, 5}, {6, 8, 10}});
+static_assert(trace(sym_mat<3, int>{{1, 2, 3}, {2, 4, 5}, {3, 5, 6}}) == 11);
+static_assert(double_dot(sym_mat<2, int>{{1, 2}, {2, 3}}, sym_mat<2, int>{{4, 5}, {5, 6}}) == 42);
+static_assert(double_dot(mat<2, 2, int>{{1, 2}, {2, 3}}, mat<2, 2, int>{{4, 5}, {5, 6}}) == 42);
+static_assert(determinant(sym_mat<3, int>{{1, 2, 3}, {2, 4, 5}, {3, 5, 6}}) == -1);
+static_assert(determinant(mat<2, 2, int>{{1, 2}, {3, 4}}) == -2);
+
+namespace {
+
+bool near(double a, double b, double tolerance = 1e-12)
+{
+  return std::abs(a - b) <= tolerance * std::max(1., std::abs(b));
+}
+
+template<std::size_t N>
+bool near(const vec<N, double>& a, const vec<N, double>& b, double tolerance = 1e-12)
+{
+  return norm(a - b) <= tolerance * std::max(1., norm(b));
+}
+
+}  // namespace
+
+TEST_CASE("eigen-decomposition of symmetric matrices", "[tensor]")
+{
+  SECTION("diagonal")
+  {
+    const auto e = eigen(sym_mat<3, double>::diagonal(vec{1., 3., 2.}));
+    CHECK(e.values == std::array{3., 2., 1.});
+    CHECK(e.vectors.col(0) == vec{0., 1., 0.});
+  }
+
+  SECTION("general")
+  {
+    const sym_mat<3, double> m{{4, 1, -2}, {1, 2, 0}, {-2, 0, 3}};
+    const auto e = eigen(m);
+    CHECK(e.values[0] >= e.values[1]);
+    CHECK(e.values[1] >= e.values[2]);
+    CHECK(near(e.values[0] + e.values[1] + e.values[2], trace(m)));
+    CHECK(near(e.values[0] * e.values[1] * e.values[2], determinant(m)));
+    for (std::size_t j = 0; j < 3; ++j) {
+      CHECK(near(m * e.vectors.col(j), e.values[j] * e.vectors.col(j)));
+      CHECK(near(norm(e.vectors.col(j)), 1.));
+    }
+    CHECK(near(determinant(e.vectors), 1.));
+  }
+
+  SECTION("repeated eigenvalues")
+  {
+    const sym_mat<3, double> m{{2, 1, 0}, {1, 2, 0}, {0, 0, 3}};
+    const auto e = eigen(m);
+    CHECK(near(e.values[0], 3.));
+    CHECK(near(e.values[1], 3.));
+    CHECK(near(e.values[2], 1.));
+    for (std::size_t j = 0; j < 3; ++j) CHECK(near(m * e.vectors.col(j), e.values[j] * e.vectors.col(j)));
+    CHECK(near(std::abs(dot(e.vectors.col(0), e.vectors.col(1))), 0.));
+  }
+}
+
+TEST_CASE("tensor quantities", "[tensor]")
+{
+  const auto sigma = sym_mat<3, double>{{100, 20, 0}, {20, -50, 10}, {0, 10, 30}} * isq::stress[kPa];
+
+  SECTION("stress times area in a direction gives a force")
+  {
+    const quantity<isq::force[N], vec<3, double>> f = sigma * (2. * isq::area[m2]) * direction(vec{0., 0., 5.});
+    CHECK(near(f.numerical_value(), vec{0., 20'000., 60'000.}));
+  }
+
+  SECTION("moment of inertia times angular velocity gives an angular momentum")
+  {
+    const auto inertia = sym_mat<3, double>::diagonal(vec{2., 3., 4.}) * isq::moment_of_inertia[kg * m2];
+    const auto omega = vec{1., 0., 2.} * isq::angular_velocity[rad / s];
+    const quantity<isq::angular_momentum[kg * m2 * rad / s], vec<3, double>> l = inertia * omega;
+    CHECK(near(l.numerical_value(), vec{2., 0., 8.}));
+  }
+
+  SECTION("a general tensor rep")
+  {
+    const auto stress = mat<3, 3, double>{{1, 0, 0}, {0, 2, 0}, {0, 0, 3}} * isq::stress[Pa];
+    const quantity<isq::force[N], vec<3, double>> f = stress * (1. * isq::area[m2]) * direction(vec{1., 1., 0.});
+    CHECK(near(f.numerical_value(), vec{1., 2., 0.} / std::sqrt(2.)));
+    CHECK(transpose(stress) == stress);
+  }
+
+  SECTION("contractions")
+  {
+    const auto epsilon = sym_mat<3, double>{{1e-3, 0, 0}, {0, 0, 5e-4}, {0, 5e-4, -2e-3}} * isq::strain[one];
+    const quantity<isq::energy[J] / isq::volume[m3]> w = double_dot(sigma, epsilon) / 2;
+    CHECK(near(w.numerical_value_in(J / m3), (100'000. * 1e-3 + 2 * 10'000. * 5e-4 - 30'000. * 2e-3) / 2));
+    CHECK(trace(sigma) == 80. * kPa);
+  }
+
+  SECTION("principal stresses")
+  {
+    const auto e = eigen(sigma);
+    static_assert(std::is_same_v<decltype(e.values)::value_type, quantity<kPa, double>>);
+    CHECK(near(e.values[0].numerical_value_in(kPa) + e.values[1].numerical_value_in(kPa) +
+                 e.values[2].numerical_value_in(kPa),
+               80.));
+    const auto axis = e.vectors.col(0);
+    CHECK(near((sigma * direction(axis)).numerical_value(), e.values[0].numerical_value_in(kPa) * axis));
+  }
+
+  SECTION("conversion of units")
+  {
+    const auto s = sym_mat<2, double>{{1, 2}, {2, 3}} * isq::stress[MPa];
+    CHECK(s.in(kPa).numerical_value() == sym_mat<2, double>{{1000, 2000}, {2000, 3000}});
+  }
+}
@@ -0,0 +1,164 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "almost_equals.h"
+#include <catch2/catch_all.hpp>
+#include <mp-units/chrono.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <mp-units/time_series.h>
+#include <chrono>
+#include <cstdint>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+namespace {
+
+inline constexpr struct start : absolute_point_origin<isq::time> {
+} start;
+
+using timestamp = quantity_point<isq::time[ms], start, std::int64_t>;
+using speed = quantity<isq::speed[m / s]>;
+using speed_series = time_series<timestamp, speed>;
+
+timestamp at(std::int64_t t) { return start + t * isq::time[ms]; }
+
+// speed rising linearly from 0 m/s by 2 m/s² with samples every 500 ms
+speed_series make_series()
+{
+  speed_series ts;
+  for (std::int64_t i = 0; i <= 10; ++i) ts.push_back(at(i * 500), static_cast<double>(i) * isq::speed[m / s]);
+  return ts;
+}
+
+}  // namespace
+
+static_assert(std::is_same_v<speed_series::duration, quantity<isq::time[ms], std::int64_t>>);
+static_assert(QuantityOf<speed_series::derivative_type, isq::speed / isq::time>);
+static_assert(QuantityOf<speed_series::integral_type, isq::length>);
+
+TEST_CASE("'time_series' stores samples in time order", "[time_series]")
+{
+  const speed_series ts = make_series();
+
+  REQUIRE(ts.size() == 11);
+  CHECK(ts.times().size() == ts.values().size());
+  CHECK(ts.time(2) == at(1000));
+  CHECK(ts.value(2) == 2 * isq::speed[m / s]);
+
+  SECTION("lookup by time")
+  {
+    CHECK(ts.lower_bound(at(1000)) == 2);
+    CHECK(ts.upper_bound(at(1000)) == 3);
+    CHECK(ts.lower_bound(at(1001)) == 3);
+    CHECK(ts.lower_bound(at(6000)) == ts.size());
+  }
+}
+
+TEST_CASE("'time_series' interpolates values between samples", "[time_series][interpolation]")
+{
+  const speed_series ts = make_series();
+
+  SECTION("linear")
+  {
+    CHECK(ts.value_at(at(1250)) == 2.5 * isq::speed[m / s]);
+    CHECK(ts.value_at(at(5000)) == 10 * isq::speed[m / s]);
+    CHECK(ts.value_at(at(0)) == 0 * isq::speed[m / s]);
+  }
+
+  SECTION("step")
+  {
+    CHECK(ts.value_at(at(1250), interpolation::step) == 2 * isq::speed[m / s]);
+    CHECK(ts.value_at(at(1499), interpolation::step) == 2 * isq::speed[m / s]);
+    CHECK(ts.value_at(at(1500), interpolation::step) == 3 * isq::speed[m / s]);
+  }
+}
+
+TEST_CASE("'time_series' resamples to a fixed period", "[time_series][resample]")
+{
+  const speed_series ts = make_series();
+
+  SECTION("linear")
+  {
+    const speed_series res = ts.resample(200 * isq::time[ms]);
+    REQUIRE(res.size() == 26);
+    CHECK(res.time(25) == at(5000));
+    for (std::size_t i = 0; i < res.size(); ++i)
+      CHECK_THAT(res.value(i), AlmostEquals(static_cast<double>(i) * 0.4 * isq::speed[m / s]));
+  }
+
+  SECTION("step")
+  {
+    const speed_series res = ts.resample(300 * isq::time[ms], interpolation::step);
+    REQUIRE(res.size() == 17);
+    CHECK(res.value(1) == 0 * isq::speed[m / s]);
+    CHECK(res.value(2) == 1 * isq::speed[m / s]);
+    CHECK(res.value(16) == 9 * isq::speed[m / s]);
+  }
+}
+
+TEST_CASE("'time_series' provides windowed aggregates", "[time_series][aggregates]")
+{
+  const speed_series ts = make_series();
+  const timestamp from = at(1250);
+  const timestamp to = at(3000);
+
+  CHECK(ts.min(from, to) == 3 * isq::speed[m / s]);
+  CHECK(ts.max(from, to) == 6 * isq::speed[m / s]);
+  CHECK_THAT(ts.mean(from, to), AlmostEquals(4.25 * isq::speed[m / s]));
+  CHECK_THAT(ts.integral(from, to), AlmostEquals(7.4375 * isq::length[m]));
+  CHECK_THAT(ts.integral(at(0), at(5000)), AlmostEquals(25. * isq::length[m]));
+}
+
+TEST_CASE("'time_series' derivatives and integrals have derived quantity types", "[time_series][derivative]")
+{
+  const speed_series ts = make_series();
+
+  SECTION("derivative of speed is speed per time")
+  {
+    const auto a = ts.derivative();
+    REQUIRE(a.size() == ts.size());
+    for (const auto& v : a.values()) CHECK_THAT(v, AlmostEquals(2. * (isq::speed / isq::time)[m / s2]));
+  }
+
+  SECTION("integral of speed is length")
+  {
+    const auto l = ts.integral();
+    REQUIRE(l.size() == ts.size());
+    CHECK(l.value(0) == 0 * isq::length[m]);
+    CHECK_THAT(l.value(2), AlmostEquals(1. * isq::length[m]));
+    CHECK_THAT(l.value(10), AlmostEquals(25. * isq::length[m]));
+  }
+}
+
+TEST_CASE("'time_series' works with chrono timestamps", "[time_series][chrono]")
+{
+  using sys_timestamp = chrono_timestamp<std::chrono::system_clock>;
+  time_series<sys_timestamp, quantity<isq::height[m]>> ts;
+  const sys_timestamp t0(std::chrono::sys_days{std::chrono::year{2023} / 9 / 1});
+  ts.push_back(t0, 1000. * isq::height[m]);
+  ts.push_back(t0 + 60 * isq::time[s], 1120. * isq::height[m]);
+
+  CHECK(ts.value_at(t0 + 15 * isq::time[s]) == 1030. * isq::height[m]);
+  CHECK_THAT(ts.derivative().value(0), AlmostEquals(2. * (isq::height / isq::time)[m / s]));
+}
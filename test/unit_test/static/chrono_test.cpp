@@ -25,6 +25,7 @@
 #include <mp-units/chrono.h>
 #include <mp-units/quantity_point.h>
 #include <mp-units/systems/si/unit_symbols.h>
+#include <cstdint>
 #include <ratio>
 
 namespace {
@@ -133,4 +134,67 @@ static_assert(is_same_v<decltype(to_chrono_duration(3 * ns))::period, std::nano>
 static_assert(to_chrono_time_point(quantity_point{sys_seconds{1s}}) == sys_seconds{1s});
 static_assert(to_chrono_time_point(quantity_point{sys_days{sys_days::duration{1}}}) == sys_days{sys_days::duration{1}});
 
+// chrono_timestamp
+using sys_nanoseconds = std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>;
+using sys_timestamp = chrono_timestamp<std::chrono::system_clock>;
+using steady_timestamp_us = chrono_timestamp<std::chrono::steady_clock, std::micro>;
+
+static_assert(is_same_v<sys_timestamp,
+                        quantity_point<isq::time[ns], chrono_point_origin<std::chrono::system_clock>, std::int64_t>>);
+static_assert(is_same_v<steady_timestamp_us,
+                        quantity_point<isq::time[us], chrono_point_origin<std::chrono::steady_clock>, std::int64_t>>);
+static_assert(is_same_v<chrono_timestamp<std::chrono::system_clock, std::ratio<1>, int>,
+                        quantity_point<isq::time[s], chrono_point_origin<std::chrono::system_clock>, int>>);
+static_assert(std::constructible_from<sys_timestamp, sys_nanoseconds>);
+static_assert(std::constructible_from<sys_timestamp, sys_seconds>);
+static_assert(!std::constructible_from<sys_timestamp, std::chrono::time_point<std::chrono::steady_clock>>);
+static_assert(!std::constructible_from<steady_timestamp_us, std::chrono::time_point<std::chrono::steady_clock>>);
+
+static_assert(sys_timestamp{sys_nanoseconds{123ns}} - chrono_point_origin<std::chrono::system_clock> == 123 * ns);
+static_assert(sys_timestamp{sys_seconds{2s}} - chrono_point_origin<std::chrono::system_clock> == 2'000'000'000 * ns);
+static_assert(to_chrono_time_point(sys_timestamp{sys_nanoseconds{123ns}}) == sys_nanoseconds{123ns});
+static_assert(is_same_v<decltype(to_chrono_time_point(sys_timestamp{})), sys_nanoseconds>);
+static_assert(is_same_v<decltype(to_chrono_time_point(steady_timestamp_us{})),
+                        std::chrono::time_point<std::chrono::steady_clock, std::chrono::microseconds>>);
+
+// tick_cast
+static_assert(is_of_type<tick_cast<sys_timestamp>(1 * s), quantity<isq::time[ns], std::int64_t>>);
+static_assert(tick_cast<sys_timestamp>(1 * s) == 1'000'000'000 * ns);
+static_assert(tick_cast<sys_timestamp>(2 * us) == 2'000 * ns);
+static_assert(tick_cast<sys_timestamp>(0.25 * us) == 250 * ns);
+static_assert(tick_cast<sys_timestamp>(1.4 * ns) == 1 * ns);
+static_assert(tick_cast<sys_timestamp>(1.5 * ns) == 2 * ns);
+static_assert(tick_cast<sys_timestamp>(-1.5 * ns) == -2 * ns);
+static_assert(tick_cast<steady_timestamp_us>(1499 * ns) == 1 * us);
+static_assert(tick_cast<steady_timestamp_us>(1500 * ns) == 2 * us);
+static_assert(tick_cast<sys_timestamp>(isq::period_duration(0.5 * s)) == 500'000'000 * ns);
+
+// advancing a timestamp by floating-point durations does not accumulate an error
+static_assert([] {
+  sys_timestamp ts{sys_nanoseconds{0ns}};
+  for (int i = 0; i < 1'000; ++i) ts += tick_cast<sys_timestamp>(0.1 * us);
+  return ts;
+}() == sys_timestamp{sys_nanoseconds{100'000ns}});
+static_assert(sys_timestamp{sys_nanoseconds{100'000'000'000'000'123ns}} + tick_cast<sys_timestamp>(1e-9 * s) -
+                sys_timestamp{sys_nanoseconds{100'000'000'000'000'000ns}} ==
+              124 * ns);
+
+// quantity_clock
+static_assert(is_same_v<quantity_clock<std::chrono::system_clock>::time_point,
+                        chrono_timestamp<std::chrono::system_clock, std::chrono::system_clock::period,
+                                         std::chrono::system_clock::rep>>);
+static_assert(is_same_v<quantity_clock<std::chrono::steady_clock, si::milli<si::second>, int>::time_point,
+                        quantity_point<isq::time[ms], chrono_point_origin<std::chrono::steady_clock>, int>>);
+static_assert(is_same_v<quantity_clock<std::chrono::system_clock, si::second, double>::time_point,
+                        quantity_point<isq::time[s], chrono_point_origin<std::chrono::system_clock>, double>>);
+static_assert(quantity_clock<std::chrono::steady_clock>::is_steady);
+static_assert(is_same_v<decltype(quantity_clock<std::chrono::steady_clock, si::second>::now()),
+                        quantity_clock<std::chrono::steady_clock, si::second>::time_point>);
+#if MP_UNITS_HAS_TSC_CLOCK
+static_assert(tsc_clock::is_steady);
+static_assert(QuantityPointLike<tsc_clock::time_point>);
+static_assert(is_same_v<quantity_clock<tsc_clock>::time_point,
+                        quantity_point<isq::time[ns], chrono_point_origin<tsc_clock>, std::int64_t>>);
+#endif
+
 }  // namespace
@@ -25,6 +25,7 @@
 #include <mp-units/quantity_point.h>
 #include <mp-units/systems/isq/isq.h>
 #include <mp-units/systems/si/si.h>
+#include <array>
 #include <limits>
 #include <type_traits>
 #include <utility>
@@ -571,6 +572,28 @@ static_assert((ground_level + 84 * m).point_for(tower_peak).quantity_from_origin
 static_assert(is_of_type<(ground_level + isq::height(short(42) * m)).point_for(mean_sea_level),
                          quantity_point<isq::height[m], mean_sea_level, int>>);
 
+// offset of origins and a change of a unit applied at once
+static_assert(quantity_point<isq::height[m], mean_sea_level>(ground_level + 2. * km).quantity_from_origin() ==
+              2042. * m);
+static_assert(quantity_point<isq::height[mm], tower_peak>(ground_level + 2. * km).quantity_from_origin() ==
+              1'958'000. * mm);
+static_assert(quantity_point<isq::height[m], ground_level>(mean_sea_level + 42 * m).quantity_from_origin() == 0. * m);
+static_assert((tower_peak + 2. * km).point_for(mean_sea_level).quantity_from_origin() == 2084. * m);
+static_assert((si::ice_point + 20. * deg_C).point_for(si::absolute_zero).quantity_from_origin() == 293.15 * K);
+static_assert(quantity_point<si::milli<si::kelvin>, si::absolute_zero>(si::ice_point + 20. * deg_C)
+                .quantity_from_origin() == 293'150. * si::milli<si::kelvin>);
+static_assert(quantity_point<si::degree_Celsius, si::ice_point>(si::absolute_zero + 300. * K).quantity_from_origin() ==
+              (300. - 273.15) * deg_C);
+
+// bulk conversion
+static_assert([] {
+  const std::array in = {ground_level + 1. * km, ground_level + 2. * km};
+  std::array<quantity_point<isq::height[m], mean_sea_level>, 2> out{};
+  const auto end = convert_points<quantity_point<isq::height[m], mean_sea_level>>(in.begin(), in.end(), out.begin());
+  return end == out.end() && out[0].quantity_from_origin() == 1042. * m &&
+         out[1].quantity_from_origin() == 2042. * m;
+}());
+
 
 ///////////////////////////////////
 // converting to a different unit
@@ -771,6 +771,17 @@ static_assert(convertible_impl(efficiency, strain) == cast);
 static_assert((position_vector / time).character == quantity_character::vector);
 static_assert((position_vector / position_vector * time).character == quantity_character::scalar);
 static_assert((velocity / acceleration).character == quantity_character::scalar);
+static_assert((stress * area).character == quantity_character::tensor);
+static_assert((stress * strain).character == quantity_character::tensor);
+static_assert((stress * position_vector).character == quantity_character::vector);
+static_assert((stress * position_vector / position_vector).character == quantity_character::tensor);
+static_assert((stress * position_vector * time).character == quantity_character::vector);
+static_assert((stress * position_vector * position_vector).character == quantity_character::tensor);
+static_assert((stress * stress * position_vector).character == quantity_character::tensor);
+static_assert((stress * strain * position_vector).character == quantity_character::tensor);
+static_assert((velocity / stress).character == quantity_character::tensor);
+static_assert((stress / position_vector).character == quantity_character::tensor);
+static_assert((position_vector * position_vector).character == quantity_character::vector);
 
 // common_quantity_spec
 static_assert(common_quantity_spec(length, length) == length);